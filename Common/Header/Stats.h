@@ -0,0 +1,55 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <utility>
+
+namespace stats
+{
+    using Clock = std::chrono::steady_clock;
+
+    /// Turns on collection. The summary goes to stderr when PrintSummary is set, spans go to TraceFile when it is not empty.
+    void Enable(const std::string& ToolName, bool PrintSummary, const std::string& TraceFile);
+
+    /// Returns true if either the summary or the trace was requested
+    bool IsEnabled();
+
+    /// Adds time to a phase of the summary without emitting a trace span, used for work that is not contiguous
+    void AddTime(const std::string& Phase, Clock::duration Duration);
+
+    /// Adds to a per-file counter of the summary
+    void AddCounter(const std::string& File, const std::string& Counter, uint64_t Value);
+
+    /// Records a finished span. Args are attached to the trace event.
+    void AddSpan(const std::string& Phase, const std::string& Detail, Clock::time_point Start, Clock::duration Duration,
+        const std::vector<std::pair<std::string, uint64_t>>& Args = {});
+
+    /// Returns the peak resident set size of this process in bytes
+    uint64_t PeakResidentBytes();
+
+    /// Prints the summary and writes the trace file. Returns false if the trace could not be written.
+    bool Finish();
+
+    /// Measures the lifetime of the object as one span of Phase
+    class ScopedSpan
+    {
+    public:
+        ScopedSpan(const char* Phase, const std::string& Detail = std::string());
+        ~ScopedSpan();
+
+        ScopedSpan(const ScopedSpan& other) = delete;
+        ScopedSpan& operator=(const ScopedSpan& other) = delete;
+
+        /// Attaches a value to the span and adds it to the per-file counter named after Detail
+        void Counter(const char* Name, uint64_t Value);
+
+    private:
+        bool Active;
+        const char* Phase;
+        std::string Detail;
+        Clock::time_point Start;
+        std::vector<std::pair<std::string, uint64_t>> Args;
+    };
+}
@@ -0,0 +1,380 @@
+#include "Stats.h"
+
+#include <rapidjson/writer.h>
+#include <rapidjson/stringbuffer.h>
+
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <map>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+namespace stats
+{
+    namespace
+    {
+        struct Span
+        {
+            std::string Phase;
+            std::string Detail;
+            Clock::time_point Start;
+            Clock::duration Duration;
+            uint32_t ThreadIndex;
+            std::vector<std::pair<std::string, uint64_t>> Args;
+        };
+
+        struct PhaseTotal
+        {
+            std::string Phase;
+            uint64_t Count = 0;
+            Clock::duration Duration = Clock::duration::zero();
+        };
+
+        struct FileCounters
+        {
+            std::string File;
+            std::vector<std::pair<std::string, uint64_t>> Counters;
+        };
+
+        struct Collector
+        {
+            bool Enabled = false;
+            bool PrintSummary = false;
+            std::string ToolName;
+            std::string TraceFile;
+
+            std::mutex Mutex;
+            std::vector<Span> Spans;
+            std::vector<PhaseTotal> Phases;
+            std::vector<FileCounters> Files;
+            std::vector<std::string> CounterNames;
+            std::map<std::thread::id, uint32_t> ThreadIndices;
+
+            uint32_t GetThreadIndex()
+            {
+                auto Result = ThreadIndices.emplace(std::this_thread::get_id(), (uint32_t)ThreadIndices.size());
+                return Result.first->second;
+            }
+
+            PhaseTotal& GetPhase(const std::string& Phase)
+            {
+                for (auto& Total : Phases)
+                {
+                    if (Total.Phase == Phase)
+                    {
+                        return Total;
+                    }
+                }
+                Phases.push_back(PhaseTotal());
+                Phases.back().Phase = Phase;
+                return Phases.back();
+            }
+
+            void AddCounter(const std::string& File, const std::string& Counter, uint64_t Value)
+            {
+                if (std::find(CounterNames.begin(), CounterNames.end(), Counter) == CounterNames.end())
+                {
+                    CounterNames.push_back(Counter);
+                }
+                auto FileItr = std::find_if(Files.begin(), Files.end(), [&](const FileCounters& Item) { return Item.File == File; });
+                if (FileItr == Files.end())
+                {
+                    Files.push_back(FileCounters());
+                    Files.back().File = File;
+                    FileItr = Files.end() - 1;
+                }
+                for (auto& Item : FileItr->Counters)
+                {
+                    if (Item.first == Counter)
+                    {
+                        Item.second += Value;
+                        return;
+                    }
+                }
+                FileItr->Counters.push_back({ Counter, Value });
+            }
+        };
+
+        Collector& GetCollector()
+        {
+            static Collector Instance;
+            return Instance;
+        }
+
+        uint64_t ProcessId()
+        {
+#if defined(_WIN32)
+            return GetCurrentProcessId();
+#else
+            return (uint64_t)getpid();
+#endif
+        }
+
+        // Steady clock epoch is shared by processes on one machine, so traces of parallel runs line up
+        uint64_t ToMicroseconds(Clock::duration Duration)
+        {
+            return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(Duration).count();
+        }
+
+        double ToMilliseconds(Clock::duration Duration)
+        {
+            return std::chrono::duration<double, std::milli>(Duration).count();
+        }
+
+        void PrintSummary(Collector& C)
+        {
+            std::cerr << "[" << C.ToolName << " stats]" << std::endl;
+            std::cerr << std::left << std::setw(24) << "phase" << std::right << std::setw(10) << "count" << std::setw(14) << "total ms" << std::endl;
+            for (auto& Total : C.Phases)
+            {
+                std::cerr << std::left << std::setw(24) << Total.Phase
+                    << std::right << std::setw(10) << Total.Count
+                    << std::setw(14) << std::fixed << std::setprecision(3) << ToMilliseconds(Total.Duration) << std::endl;
+            }
+
+            if (!C.Files.empty())
+            {
+                std::cerr << std::endl << std::left << std::setw(40) << "file";
+                for (auto& Name : C.CounterNames)
+                {
+                    std::cerr << std::right << std::setw(14) << Name;
+                }
+                std::cerr << std::endl;
+                for (auto& File : C.Files)
+                {
+                    std::cerr << std::left << std::setw(40) << File.File;
+                    for (auto& Name : C.CounterNames)
+                    {
+                        uint64_t Value = 0;
+                        for (auto& Item : File.Counters)
+                        {
+                            if (Item.first == Name)
+                            {
+                                Value = Item.second;
+                            }
+                        }
+                        std::cerr << std::right << std::setw(14) << Value;
+                    }
+                    std::cerr << std::endl;
+                }
+            }
+
+            std::cerr << std::endl << "peak rss: " << std::fixed << std::setprecision(1) << PeakResidentBytes() / (1024.0 * 1024.0) << " MB" << std::endl;
+        }
+
+        bool WriteTrace(Collector& C)
+        {
+            using namespace rapidjson;
+            StringBuffer Buffer;
+            Writer<StringBuffer> Writer(Buffer);
+            auto Pid = ProcessId();
+
+            Writer.StartObject();
+            Writer.String("traceEvents");
+            Writer.StartArray();
+
+            Writer.StartObject();
+            Writer.String("name");
+            Writer.String("process_name");
+            Writer.String("ph");
+            Writer.String("M");
+            Writer.String("pid");
+            Writer.Uint64(Pid);
+            Writer.String("args");
+            Writer.StartObject();
+            Writer.String("name");
+            Writer.String(C.ToolName.c_str());
+            Writer.EndObject();
+            Writer.EndObject();
+
+            for (auto& Item : C.Spans)
+            {
+                Writer.StartObject();
+                Writer.String("name");
+                Writer.String(Item.Detail.empty() ? Item.Phase.c_str() : (Item.Phase + " " + Item.Detail).c_str());
+                Writer.String("cat");
+                Writer.String(Item.Phase.c_str());
+                Writer.String("ph");
+                Writer.String("X");
+                Writer.String("ts");
+                Writer.Uint64(ToMicroseconds(Item.Start.time_since_epoch()));
+                Writer.String("dur");
+                Writer.Uint64(ToMicroseconds(Item.Duration));
+                Writer.String("pid");
+                Writer.Uint64(Pid);
+                Writer.String("tid");
+                Writer.Uint(Item.ThreadIndex);
+                Writer.String("args");
+                Writer.StartObject();
+                if (!Item.Detail.empty())
+                {
+                    Writer.String("file");
+                    Writer.String(Item.Detail.c_str());
+                }
+                for (auto& Arg : Item.Args)
+                {
+                    Writer.String(Arg.first.c_str());
+                    Writer.Uint64(Arg.second);
+                }
+                Writer.EndObject();
+                Writer.EndObject();
+            }
+
+            Writer.EndArray();
+            Writer.String("displayTimeUnit");
+            Writer.String("ms");
+            Writer.EndObject();
+
+            std::ofstream ofs(C.TraceFile);
+            if (!ofs.is_open())
+            {
+                std::cerr << "Could not write " << C.TraceFile << std::endl;
+                return false;
+            }
+            ofs.write(Buffer.GetString(), Buffer.GetSize());
+            return true;
+        }
+    }
+
+    //--------------------------------------------------------------------------------------------------
+    void Enable(const std::string& ToolName, bool PrintSummary, const std::string& TraceFile)
+    {
+        auto& C = GetCollector();
+        C.ToolName = ToolName;
+        C.PrintSummary = PrintSummary;
+        C.TraceFile = TraceFile;
+        C.Enabled = PrintSummary || !TraceFile.empty();
+    }
+
+    //--------------------------------------------------------------------------------------------------
+    bool IsEnabled()
+    {
+        return GetCollector().Enabled;
+    }
+
+    //--------------------------------------------------------------------------------------------------
+    void AddTime(const std::string& Phase, Clock::duration Duration)
+    {
+        auto& C = GetCollector();
+        if (!C.Enabled)
+        {
+            return;
+        }
+        std::lock_guard<std::mutex> Lock(C.Mutex);
+        auto& Total = C.GetPhase(Phase);
+        Total.Count++;
+        Total.Duration += Duration;
+    }
+
+    //--------------------------------------------------------------------------------------------------
+    void AddCounter(const std::string& File, const std::string& Counter, uint64_t Value)
+    {
+        auto& C = GetCollector();
+        if (!C.Enabled)
+        {
+            return;
+        }
+        std::lock_guard<std::mutex> Lock(C.Mutex);
+        C.AddCounter(File, Counter, Value);
+    }
+
+    //--------------------------------------------------------------------------------------------------
+    void AddSpan(const std::string& Phase, const std::string& Detail, Clock::time_point Start, Clock::duration Duration,
+        const std::vector<std::pair<std::string, uint64_t>>& Args)
+    {
+        auto& C = GetCollector();
+        if (!C.Enabled)
+        {
+            return;
+        }
+        std::lock_guard<std::mutex> Lock(C.Mutex);
+        auto& Total = C.GetPhase(Phase);
+        Total.Count++;
+        Total.Duration += Duration;
+        if (!C.TraceFile.empty())
+        {
+            C.Spans.push_back({ Phase, Detail, Start, Duration, C.GetThreadIndex(), Args });
+        }
+    }
+
+    //--------------------------------------------------------------------------------------------------
+    uint64_t PeakResidentBytes()
+    {
+#if defined(_WIN32)
+        PROCESS_MEMORY_COUNTERS Counters;
+        if (!GetProcessMemoryInfo(GetCurrentProcess(), &Counters, sizeof(Counters)))
+        {
+            return 0;
+        }
+        return Counters.PeakWorkingSetSize;
+#else
+        rusage Usage;
+        if (getrusage(RUSAGE_SELF, &Usage) != 0)
+        {
+            return 0;
+        }
+#if defined(__APPLE__)
+        return (uint64_t)Usage.ru_maxrss;
+#else
+        return (uint64_t)Usage.ru_maxrss * 1024;
+#endif
+#endif
+    }
+
+    //--------------------------------------------------------------------------------------------------
+    bool Finish()
+    {
+        auto& C = GetCollector();
+        if (!C.Enabled)
+        {
+            return true;
+        }
+        std::lock_guard<std::mutex> Lock(C.Mutex);
+        if (C.PrintSummary)
+        {
+            PrintSummary(C);
+        }
+        return C.TraceFile.empty() || WriteTrace(C);
+    }
+
+    //--------------------------------------------------------------------------------------------------
+    ScopedSpan::ScopedSpan(const char* Phase, const std::string& Detail)
+        : Active(IsEnabled()), Phase(Phase)
+    {
+        if (Active)
+        {
+            this->Detail = Detail;
+            Start = Clock::now();
+        }
+    }
+
+    //--------------------------------------------------------------------------------------------------
+    ScopedSpan::~ScopedSpan()
+    {
+        if (Active)
+        {
+            AddSpan(Phase, Detail, Start, Clock::now() - Start, Args);
+        }
+    }
+
+    //--------------------------------------------------------------------------------------------------
+    void ScopedSpan::Counter(const char* Name, uint64_t Value)
+    {
+        if (Active)
+        {
+            Args.push_back({ Name, Value });
+            AddCounter(Detail, Name, Value);
+        }
+    }
+}
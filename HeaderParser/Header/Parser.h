@@ -8,6 +8,7 @@
 #include <rapidjson/stringbuffer.h>
 
 #include <string>
+#include <chrono>
 
 namespace hp
 {
@@ -50,6 +51,20 @@ namespace hp
         /// Returns the result of a previous parse
         std::string result() const;
 
+        /// Statistics of the last parsed input
+        struct Statistics
+        {
+            std::size_t Tokens;
+            std::size_t SkippedBytes;
+            std::chrono::steady_clock::duration TokenizeTime;
+        };
+
+        /// Enables collecting statistics, see Tokenizer::SetCollectStats
+        using Tokenizer::SetCollectStats;
+
+        /// Returns the statistics of a previous parse, only filled when collecting is enabled
+        Statistics statistics() const;
+
     protected:
         /// Called to parse the next statement. Returns false if there are no more statements.
         bool ParseStatement(Token* const CurrentClass = nullptr);
@@ -100,6 +115,7 @@ namespace hp
         Scope Scopes[128];
         Scope *TopScope;
         Phase phase;
+        std::size_t SkippedBytes = 0;
         void ParseProperty(Token &token, const std::string& macroName);
     };
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <cstdlib>
 #include <string>
@@ -24,6 +25,9 @@ namespace hp
         /// Parses a token from the stream
         bool GetToken(Token& token, bool angleBracketsForStrings = false, bool seperateBraces = false);
 
+        /// Enables counting and timing of parsed tokens, the counters are cleared by Reset
+        void SetCollectStats(bool collect) { CollectStats = collect; }
+
         /// Parses an identifier from the stream
         bool GetIdentifier(Token& token);
 
@@ -31,6 +35,9 @@ namespace hp
         void UngetToken(const Token &token);
 
     protected:
+        /// Parses a token from the stream, GetToken wraps this to collect statistics
+        bool ReadToken(Token& token, bool angleBracketsForStrings, bool seperateBraces);
+
         /**
         * @brief Returns the next character from the stream.
         * @details Returns the next character from the stream while advancing the cursor position.
@@ -90,5 +97,10 @@ namespace hp
 
         Comment ThisComment;
         Comment LastComment;
+
+        /// Statistics of the current input, only collected when enabled
+        bool CollectStats = false;
+        std::size_t TokenCount = 0;
+        std::chrono::steady_clock::duration TokenizeTime = std::chrono::steady_clock::duration::zero();
     };
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "Parser.h"
 #include "Options.h"
+#include "Stats.h"
 
 #include <tclap/CmdLine.h>
 
@@ -85,6 +86,8 @@ int main(int argc, char** argv)
     vector<string> InputDirs;
     string OutputFile;
     bool IsDirAsSearchPath;
+    bool PrintStats;
+    string TraceFile;
     try
     {
         using namespace TCLAP;
@@ -101,6 +104,8 @@ int main(int argc, char** argv)
         ValueArg<string> OutputFileArg("o", "output", "Output file path for writing json ast", false, "", "", cmd);
         SwitchArg IsDirArg("d", "directory", "Input Files are directories", cmd, false);
         SwitchArg IsDirAsSearchPathArg("s", "searchpath", "Treat Directories as search path", cmd, true);
+        SwitchArg StatsArg("", "stats", "Print time spent per phase, per file counters and peak memory to stderr", cmd, false);
+        ValueArg<string> TraceArg("", "trace", "Write phase spans to a chrome trace-event json file", false, "", "", cmd);
         UnlabeledMultiArg<string> InputFilesArg("InputFiles", "The files to process", true, "", cmd);
 
         cmd.parse(argc, argv);
@@ -125,6 +130,8 @@ int main(int argc, char** argv)
         }
         IsDirAsSearchPath = IsDirAsSearchPathArg.getValue();
         OutputFile = OutputFileArg.getValue();
+        PrintStats = StatsArg.getValue();
+        TraceFile = TraceArg.getValue();
     }
     catch (TCLAP::ArgException& e)
     {
@@ -132,10 +139,15 @@ int main(int argc, char** argv)
         return -1;
     }
 
+    stats::Enable("hp", PrintStats, TraceFile);
+
     for (auto& Dir : InputDirs)
     {
         list<string> FileList;
-        DFSFolder(Dir, FileList);
+        {
+            stats::ScopedSpan Span("walk", Dir);
+            DFSFolder(Dir, FileList);
+        }
         for (auto& FileName : FileList)
         {
             InputFiles.push_back({ FileName, Dir });
@@ -144,51 +156,82 @@ int main(int argc, char** argv)
     
     ifstream ifs;
     Parser parser(AppOption);
+    parser.SetCollectStats(stats::IsEnabled());
     stringstream buffer;
     parser.Open();
     for (auto& InputFile: InputFiles)
     {
-        ifs.open(InputFile.first);
-        if (!ifs.is_open())
+        string FileName = InputFile.first;
+        if (IsDirAsSearchPath)
         {
-            cerr << "Could not open " << InputFile.first << endl;
-            ifs.clear();
-            continue;
+            RemoveSearchPath(InputFile.second, FileName);
         }
 
-        
-        buffer << ifs.rdbuf();
-        ifs.clear();
-        ifs.close();
-        if (IsDirAsSearchPath)
         {
-            RemoveSearchPath(InputFile.second, InputFile.first);
+            stats::ScopedSpan Span("read", FileName);
+            ifs.open(InputFile.first);
+            if (!ifs.is_open())
+            {
+                cerr << "Could not open " << InputFile.first << endl;
+                ifs.clear();
+                continue;
+            }
+
+            buffer << ifs.rdbuf();
+            ifs.clear();
+            ifs.close();
+            // The put position is the size read, str() would copy the whole file. Reading an empty file sets failbit,
+            // tellp then returns -1.
+            auto Size = buffer.tellp();
+            Span.Counter("bytes", Size > 0 ? static_cast<uint64_t>(Size) : 0);
         }
-        if (!parser.Parse(buffer.str().c_str(), InputFile.first.c_str()))
+
+        auto ParseStart = stats::Clock::now();
+        if (!parser.Parse(buffer.str().c_str(), FileName.c_str()))
         {
-            cerr << "Could not parse " << InputFile.first << endl;
+            cerr << "Could not parse " << FileName << endl;
             return -1;
         }
+        if (stats::IsEnabled())
+        {
+            auto ParseStats = parser.statistics();
+            stats::AddSpan("parse", FileName, ParseStart, stats::Clock::now() - ParseStart, {
+                { "tokens", ParseStats.Tokens },
+                { "skipped", ParseStats.SkippedBytes },
+                { "tokenize_us", (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(ParseStats.TokenizeTime).count() }
+            });
+            stats::AddTime("parse/tokenize", ParseStats.TokenizeTime);
+            stats::AddCounter(FileName, "tokens", ParseStats.Tokens);
+            stats::AddCounter(FileName, "skipped", ParseStats.SkippedBytes);
+        }
         buffer.clear();
         buffer.str("");
     }
     parser.Close();
 
-    if (OutputFile.empty()) {
-        cout << parser.result() << endl;
-    }
-    else 
     {
-        ofstream ofs(OutputFile);
-        if (!ofs.is_open())
+        stats::ScopedSpan Span("write json", OutputFile.empty() ? "stdout" : OutputFile);
+        if (OutputFile.empty()) {
+            cout << parser.result() << endl;
+        }
+        else 
         {
-            cerr << "Could not write " << OutputFile << endl;
-            ofs.clear();
-            return -1;
+            ofstream ofs(OutputFile);
+            if (!ofs.is_open())
+            {
+                cerr << "Could not write " << OutputFile << endl;
+                ofs.clear();
+                return -1;
+            }
+            ofs << parser.result();
+            ofs.close();
         }
-        ofs << parser.result();
-        ofs.close();
+    }
+
+    if (!stats::Finish())
+    {
+        return -1;
     }
     
     return 0;
-}
+}
\ No newline at end of file
@@ -163,6 +163,7 @@ namespace hp {
 
         // Pass the input to the tokenizer
         Reset(Input);
+        SkippedBytes = 0;
 
         try
         {
@@ -217,6 +218,12 @@ namespace hp {
         return std::string(Buffer.GetString(), Buffer.GetString() + Buffer.GetSize());
     }
 
+    //--------------------------------------------------------------------------------------------------
+    Parser::Statistics Parser::statistics() const
+    {
+        return Statistics{ TokenCount, SkippedBytes, TokenizeTime };
+    }
+
     //--------------------------------------------------------------------------------------------------
     bool Parser::ParseStatement(Token* const CurrentClass)
     {
@@ -336,6 +343,7 @@ namespace hp {
     //--------------------------------------------------------------------------------------------------
     bool Parser::SkipDeclaration(Token &token)
     {
+        std::size_t StartPos = CursorPos;
         int32_t scopeDepth = 0;
         while (GetToken(token))
         {
@@ -359,6 +367,10 @@ namespace hp {
             }
         }
 
+        if (CollectStats)
+        {
+            SkippedBytes += CursorPos - StartPos;
+        }
         return true;
     }
 
@@ -28,6 +28,8 @@ namespace hp {
         InputLength = std::char_traits<char>::length(input);
         CursorPos = 0;
         CursorLine = startingLine;
+        TokenCount = 0;
+        TokenizeTime = std::chrono::steady_clock::duration::zero();
     }
 
     //--------------------------------------------------------------------------------------------------
@@ -248,6 +250,24 @@ namespace hp {
 
     //--------------------------------------------------------------------------------------------------
     bool Tokenizer::GetToken(Token &token, bool angleBracketsForStrings, bool seperateBraces)
+    {
+        if (!CollectStats)
+        {
+            return ReadToken(token, angleBracketsForStrings, seperateBraces);
+        }
+
+        auto Start = std::chrono::steady_clock::now();
+        bool Result = ReadToken(token, angleBracketsForStrings, seperateBraces);
+        TokenizeTime += std::chrono::steady_clock::now() - Start;
+        if (Result)
+        {
+            ++TokenCount;
+        }
+        return Result;
+    }
+
+    //--------------------------------------------------------------------------------------------------
+    bool Tokenizer::ReadToken(Token &token, bool angleBracketsForStrings, bool seperateBraces)
     {
         // Get the next character
         char c = GetLeadingChar();
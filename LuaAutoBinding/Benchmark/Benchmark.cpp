@@ -0,0 +1,534 @@
+#include "CodeGenerator.h"
+#include "Stats.h"
+
+#include <tclap/CmdLine.h>
+
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/ostreamwrapper.h>
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <cstdlib>
+#include <set>
+#include <algorithm>
+
+using std::string;
+using std::vector;
+
+using std::cout;
+using std::cerr;
+using std::endl;
+
+struct SyntheticConfig
+{
+    unsigned Classes;
+    unsigned Members;
+    unsigned ClassesPerFile;
+    // Earlier headers included by each header
+    unsigned Includes;
+};
+
+// What WriteSyntheticAST produced
+struct SyntheticShape
+{
+    size_t Files = 0;
+    size_t Declarations = 0;
+    size_t IncludeEdges = 0;
+    size_t Bytes = 0;
+};
+
+typedef rapidjson::PrettyWriter<rapidjson::OStreamWrapper> AstWriter;
+
+void WriteLiteralType(AstWriter& Writer, const char* Name)
+{
+    Writer.StartObject();
+    Writer.String("type");
+    Writer.String("literal");
+    Writer.String("name");
+    Writer.String(Name);
+    Writer.EndObject();
+}
+
+enum class FunctionShape
+{
+    Member,
+    Static,
+    // LUA_PROPERTY getter, every other one with a setter
+    Property
+};
+
+void WriteFunction(AstWriter& Writer, unsigned Index, FunctionShape Shape)
+{
+    string Name = (Shape == FunctionShape::Property ? "GetValue" : "Method") + std::to_string(Index);
+    Writer.StartObject();
+    Writer.String("type");
+    Writer.String("function");
+    Writer.String("macro");
+    Writer.String(Shape == FunctionShape::Property ? "LUA_PROPERTY" : "LUA_FUNCTION");
+    Writer.String("line");
+    Writer.Uint(Index);
+    Writer.String("comment");
+    Writer.String("Synthetic member function.");
+    Writer.String("meta");
+    Writer.StartObject();
+    if (Shape == FunctionShape::Property && Index % 2 == 0)
+    {
+        Writer.String("setter");
+        Writer.String(("SetValue" + std::to_string(Index)).c_str());
+    }
+    Writer.EndObject();
+    Writer.String("access");
+    Writer.String("public");
+    if (Shape == FunctionShape::Static)
+    {
+        Writer.String("static");
+        Writer.Bool(true);
+    }
+    Writer.String("returnType");
+    WriteLiteralType(Writer, "int");
+    Writer.String("name");
+    Writer.String(Name.c_str());
+    Writer.String("parameters");
+    Writer.StartArray();
+    Writer.StartObject();
+    Writer.String("type");
+    WriteLiteralType(Writer, "int");
+    Writer.String("name");
+    Writer.String("Value");
+    Writer.EndObject();
+    Writer.EndArray();
+    Writer.EndObject();
+}
+
+void WriteData(AstWriter& Writer, unsigned Index)
+{
+    string Name = "Field" + std::to_string(Index);
+    Writer.StartObject();
+    Writer.String("type");
+    Writer.String("property");
+    Writer.String("macro");
+    Writer.String("LUA_DATA");
+    Writer.String("line");
+    Writer.Uint(Index);
+    Writer.String("meta");
+    Writer.StartObject();
+    Writer.EndObject();
+    Writer.String("access");
+    Writer.String("public");
+    Writer.String("dataType");
+    WriteLiteralType(Writer, "int");
+    Writer.String("name");
+    Writer.String(Name.c_str());
+    Writer.EndObject();
+}
+
+void WriteEnum(AstWriter& Writer, unsigned Index)
+{
+    string Name = "Enum" + std::to_string(Index);
+    Writer.StartObject();
+    Writer.String("type");
+    Writer.String("enum");
+    Writer.String("line");
+    Writer.Uint(Index);
+    Writer.String("meta");
+    Writer.StartObject();
+    Writer.EndObject();
+    Writer.String("name");
+    Writer.String(Name.c_str());
+    Writer.String("cxxclass");
+    Writer.Bool(true);
+    Writer.String("members");
+    Writer.StartArray();
+    for (auto Key : { "First", "Second", "Third", "Fourth" })
+    {
+        Writer.StartObject();
+        Writer.String("key");
+        Writer.String(Key);
+        Writer.EndObject();
+    }
+    Writer.EndArray();
+    Writer.EndObject();
+}
+
+// Members cycle through function, data, property, static function and enum.
+// Every other class derives from the class before it in the same header.
+void WriteClass(AstWriter& Writer, unsigned Index, bool HasParent, const SyntheticConfig& Config)
+{
+    string Name = "Class" + std::to_string(Index);
+    Writer.StartObject();
+    Writer.String("type");
+    Writer.String("class");
+    Writer.String("line");
+    Writer.Uint(Index);
+    Writer.String("meta");
+    Writer.StartObject();
+    Writer.EndObject();
+    Writer.String("name");
+    Writer.String(Name.c_str());
+    if (HasParent)
+    {
+        Writer.String("parents");
+        Writer.StartArray();
+        Writer.StartObject();
+        Writer.String("access");
+        Writer.String("public");
+        Writer.String("name");
+        WriteLiteralType(Writer, ("Class" + std::to_string(Index - 1)).c_str());
+        Writer.EndObject();
+        Writer.EndArray();
+    }
+    Writer.String("members");
+    Writer.StartArray();
+    for (unsigned i = 0; i < Config.Members; ++i)
+    {
+        switch (i % 5)
+        {
+        case 0:
+            WriteFunction(Writer, i, FunctionShape::Member);
+            break;
+        case 1:
+            WriteData(Writer, i);
+            break;
+        case 2:
+            WriteFunction(Writer, i, FunctionShape::Property);
+            break;
+        case 3:
+            WriteFunction(Writer, i, FunctionShape::Static);
+            break;
+        default:
+            WriteEnum(Writer, i);
+            break;
+        }
+    }
+    Writer.EndArray();
+    Writer.EndObject();
+}
+
+string SyntheticFileName(unsigned FileIndex)
+{
+    return "Synthetic" + std::to_string(FileIndex) + ".h";
+}
+
+bool WriteSyntheticAST(const string& FileName, const SyntheticConfig& Config, SyntheticShape& Shape)
+{
+    std::ofstream ofs(FileName);
+    if (!ofs.is_open())
+    {
+        cerr << "Could not write " << FileName << endl;
+        return false;
+    }
+    rapidjson::OStreamWrapper Stream(ofs);
+    AstWriter Writer(Stream);
+    Shape = SyntheticShape();
+    Writer.StartArray();
+    for (unsigned Class = 0, File = 0; Class < Config.Classes; Class += Config.ClassesPerFile, ++File)
+    {
+        Writer.StartObject();
+        Writer.String("file");
+        Writer.String(SyntheticFileName(File).c_str());
+        Writer.String("content");
+        Writer.StartArray();
+        // Spread the includes over the earlier headers so the include graph is deep as well as wide
+        std::set<unsigned> Included;
+        for (unsigned i = 0; i < Config.Includes && i < File; ++i)
+        {
+            Included.insert((File - 1) - (File - 1) * i / Config.Includes);
+        }
+        for (auto Target : Included)
+        {
+            Writer.StartObject();
+            Writer.String("type");
+            Writer.String("include");
+            Writer.String("file");
+            Writer.String(SyntheticFileName(Target).c_str());
+            Writer.EndObject();
+        }
+        Shape.IncludeEdges += Included.size();
+        for (unsigned i = Class; i < Config.Classes && i < Class + Config.ClassesPerFile; ++i)
+        {
+            WriteClass(Writer, i, i != Class && i % 2 == 1, Config);
+            Shape.Declarations += 1 + Config.Members;
+        }
+        Writer.EndArray();
+        Writer.EndObject();
+        ++Shape.Files;
+    }
+    Writer.EndArray();
+    ofs.flush();
+    Shape.Bytes = static_cast<size_t>(ofs.tellp());
+    return true;
+}
+
+double Milliseconds(stats::Clock::duration Duration)
+{
+    return std::chrono::duration<double, std::milli>(Duration).count();
+}
+
+struct RunResult
+{
+    double ParseTime = 0;
+    double GenerateTime = 0;
+    size_t PeakAfterParse = 0;
+    size_t PeakAfterGenerate = 0;
+    size_t OutputBytes = 0;
+};
+
+CodeGenerator MakeGenerator()
+{
+    CodeGenerator cg;
+    cg.FunctionPropertyMacro = "LUA_PROPERTY";
+    return cg;
+}
+
+bool RunGenerator(const string& FileName, CodeGenerator::ASTLoader Loader, RunResult& Result)
+{
+    auto cg = MakeGenerator();
+    cg.Loader = Loader;
+    auto Start = stats::Clock::now();
+    if (!cg.ParseAST(FileName))
+    {
+        return false;
+    }
+    Result.ParseTime = Milliseconds(stats::Clock::now() - Start);
+    Result.PeakAfterParse = stats::PeakResidentBytes();
+
+    Start = stats::Clock::now();
+    Result.OutputBytes = cg.GetResult().size();
+    Result.GenerateTime = Milliseconds(stats::Clock::now() - Start);
+    Result.PeakAfterGenerate = stats::PeakResidentBytes();
+    return true;
+}
+
+bool RunLoader(const string& FileName, CodeGenerator::ASTLoader Loader, const char* LoaderName)
+{
+    RunResult Result;
+    if (!RunGenerator(FileName, Loader, Result))
+    {
+        return false;
+    }
+    cout << LoaderName
+        << "\tparse " << Result.ParseTime << " ms"
+        << "\tpeak rss after parse " << Result.PeakAfterParse / (1024 * 1024) << " MB"
+        << "\tgenerate " << Result.GenerateTime << " ms"
+        << "\tpeak rss after generate " << Result.PeakAfterGenerate / (1024 * 1024) << " MB"
+        << "\toutput " << Result.OutputBytes << " bytes" << endl;
+    return true;
+}
+
+// Loads once, then generates with each thread count and checks every output against the single thread one
+bool RunJobs(const string& FileName, const vector<unsigned>& JobCounts)
+{
+    string Reference;
+    double SerialTime = 0;
+    for (auto Jobs : JobCounts)
+    {
+        auto cg = MakeGenerator();
+        cg.Jobs = Jobs;
+        if (!cg.ParseAST(FileName))
+        {
+            return false;
+        }
+        auto Start = stats::Clock::now();
+        auto Result = cg.GetResult();
+        auto GenerateTime = Milliseconds(stats::Clock::now() - Start);
+        if (Reference.empty())
+        {
+            Reference = Result;
+            SerialTime = GenerateTime;
+        }
+        cout << "jobs " << Jobs
+            << "\tgenerate " << GenerateTime << " ms"
+            << "\tspeedup " << SerialTime / GenerateTime
+            << (Result == Reference ? "\tidentical" : "\tDIFFERENT") << endl;
+        if (Result != Reference)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Generates with each thunk mode. With a compile command each output is also written next to the ast and compiled,
+// the command gets the file name appended and has to find lua, luaportal and the lab runtime itself.
+bool RunThunks(const string& FileName, const vector<string>& Modes, const string& CompileCommand)
+{
+    for (auto& Mode : Modes)
+    {
+        auto cg = MakeGenerator();
+        if (Mode == "shared")
+        {
+            cg.Thunks = CodeGenerator::ThunkMode::Shared;
+        }
+        else if (Mode == "direct")
+        {
+            cg.Thunks = CodeGenerator::ThunkMode::Direct;
+        }
+        else if (Mode == "table")
+        {
+            cg.Thunks = CodeGenerator::ThunkMode::Table;
+        }
+        else if (Mode != "portal")
+        {
+            cerr << "unknown thunk mode " << Mode << endl;
+            return false;
+        }
+        if (!cg.ParseAST(FileName))
+        {
+            return false;
+        }
+        auto Start = stats::Clock::now();
+        auto Result = cg.GetResult();
+        auto GenerateTime = Milliseconds(stats::Clock::now() - Start);
+        cout << "thunks " << Mode
+            << "\tgenerate " << GenerateTime << " ms"
+            << "\toutput " << Result.size() << " bytes";
+        if (!CompileCommand.empty())
+        {
+            auto OutputFile = FileName + "." + Mode + ".cpp";
+            std::ofstream ofs(OutputFile);
+            ofs << Result;
+            ofs.close();
+            Start = stats::Clock::now();
+            auto Status = std::system((CompileCommand + " " + OutputFile).c_str());
+            cout << "\tcompile " << Milliseconds(stats::Clock::now() - Start) << " ms" << (Status == 0 ? "" : "\tFAILED");
+        }
+        cout << endl;
+    }
+    return true;
+}
+
+// One row per size, the per declaration columns stay flat unless something scales worse than linearly.
+// Peak rss never shrinks within a process, so sizes run in ascending order.
+bool RunSweep(const string& AstFile, SyntheticConfig Config, vector<unsigned> Sizes)
+{
+    std::sort(Sizes.begin(), Sizes.end());
+    cout << "decls\tfiles\tincludes\tast bytes\tparse ms\tgenerate ms\tparse ns/decl\tgenerate ns/decl\tpeak rss MB\toutput bytes" << endl;
+    for (auto Size : Sizes)
+    {
+        Config.Classes = std::max(1u, Size / (Config.Members + 1));
+        SyntheticShape Shape;
+        if (!WriteSyntheticAST(AstFile, Config, Shape))
+        {
+            return false;
+        }
+        RunResult Result;
+        if (!RunGenerator(AstFile, CodeGenerator::ASTLoader::Streaming, Result))
+        {
+            return false;
+        }
+        cout << Shape.Declarations
+            << "\t" << Shape.Files
+            << "\t" << Shape.IncludeEdges
+            << "\t" << Shape.Bytes
+            << "\t" << Result.ParseTime
+            << "\t" << Result.GenerateTime
+            << "\t" << Result.ParseTime * 1e6 / Shape.Declarations
+            << "\t" << Result.GenerateTime * 1e6 / Shape.Declarations
+            << "\t" << Result.PeakAfterGenerate / (1024 * 1024)
+            << "\t" << Result.OutputBytes << endl;
+    }
+    return true;
+}
+
+vector<unsigned> ParseCounts(const string& List)
+{
+    vector<unsigned> Counts;
+    std::stringstream ss(List);
+    string Item;
+    while (std::getline(ss, Item, ','))
+    {
+        auto Count = std::stoul(Item);
+        Counts.push_back(static_cast<unsigned>(Count == 0 ? 1 : Count));
+    }
+    return Counts;
+}
+
+vector<string> ParseNames(const string& List)
+{
+    vector<string> Names;
+    std::stringstream ss(List);
+    string Item;
+    while (std::getline(ss, Item, ','))
+    {
+        Names.push_back(Item);
+    }
+    return Names;
+}
+
+int main(int argc, const char** argv)
+{
+    SyntheticConfig Config;
+    string AstFile;
+    string Loaders;
+    string JobList;
+    string SweepList;
+    string ThunkList;
+    string CompileCommand;
+    try
+    {
+        using namespace TCLAP;
+
+        CmdLine cmd("Lua Auto Binding Benchmark");
+
+        ValueArg<unsigned> ClassesArg("n", "classes", "Number of synthetic classes.", false, 10000, "", cmd);
+        ValueArg<unsigned> MembersArg("m", "members", "Members per class, cycling through function, data, property, static function and enum.", false, 20, "", cmd);
+        ValueArg<unsigned> ClassesPerFileArg("", "classesperfile", "Classes per synthetic header.", false, 10, "", cmd);
+        ValueArg<unsigned> IncludesArg("i", "includes", "Earlier synthetic headers included by each header.", false, 4, "", cmd);
+        ValueArg<string> AstFileArg("o", "ast", "Where to write the synthetic ast.", false, "labbench_ast.json", "", cmd);
+        ValueArg<string> LoadersArg("l", "loader", "sax, dom or both. Both runs sax first, since peak rss only grows.", false, "both", "", cmd);
+        ValueArg<string> JobsArg("j", "jobs", "Comma separated thread counts, e.g. 1,2,4,8,16,32. Generation is timed at each count after the loaders ran.", false, "", "", cmd);
+        ValueArg<string> ThunksArg("t", "thunks", "Comma separated thunk modes out of portal, shared, direct and table. Generation is timed with each after the loaders ran.", false, "", "", cmd);
+        ValueArg<string> CompileArg("c", "compile", "Compiler command timed on the output of each --thunks mode, the file name is appended.", false, "", "", cmd);
+        ValueArg<string> SweepArg("s", "sweep", "Comma separated declaration counts, e.g. 1000,10000,100000,1000000. Prints one row per size with the sax loader instead of the single run.", false, "", "", cmd);
+
+        cmd.parse(argc, argv);
+        Config.Classes = ClassesArg.getValue();
+        Config.Members = MembersArg.getValue();
+        Config.ClassesPerFile = ClassesPerFileArg.getValue() == 0 ? 1 : ClassesPerFileArg.getValue();
+        Config.Includes = IncludesArg.getValue();
+        AstFile = AstFileArg.getValue();
+        Loaders = LoadersArg.getValue();
+        JobList = JobsArg.getValue();
+        SweepList = SweepArg.getValue();
+        ThunkList = ThunksArg.getValue();
+        CompileCommand = CompileArg.getValue();
+    }
+    catch (TCLAP::ArgException& e)
+    {
+        cerr << "error: " << e.error() << " for arg " << e.argId() << endl;
+        return -1;
+    }
+
+    if (!SweepList.empty())
+    {
+        return RunSweep(AstFile, Config, ParseCounts(SweepList)) ? 0 : 1;
+    }
+
+    SyntheticShape Shape;
+    if (!WriteSyntheticAST(AstFile, Config, Shape))
+    {
+        return -1;
+    }
+    cout << "declarations " << Shape.Declarations << " in " << Shape.Files << " headers, include edges " << Shape.IncludeEdges
+        << ", ast " << Shape.Bytes << " bytes, baseline peak rss " << stats::PeakResidentBytes() / (1024 * 1024) << " MB" << endl;
+
+    if ((Loaders == "sax" || Loaders == "both") && !RunLoader(AstFile, CodeGenerator::ASTLoader::Streaming, "sax"))
+    {
+        return 1;
+    }
+    if ((Loaders == "dom" || Loaders == "both") && !RunLoader(AstFile, CodeGenerator::ASTLoader::Document, "dom"))
+    {
+        return 1;
+    }
+    if (!JobList.empty() && !RunJobs(AstFile, ParseCounts(JobList)))
+    {
+        return 1;
+    }
+    if (!ThunkList.empty() && !RunThunks(AstFile, ParseNames(ThunkList), CompileCommand))
+    {
+        return 1;
+    }
+    return 0;
+}
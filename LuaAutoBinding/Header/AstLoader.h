@@ -0,0 +1,38 @@
+#pragma once
+
+#include "AstModel.h"
+
+#include <string>
+#include <vector>
+
+namespace lab
+{
+    struct LoaderOptions
+    {
+        std::string AutoNullMacro;
+        std::string FunctionPropertyMacro;
+        std::string CFunctionMacro;
+        /// Builds the model from reader events instead of parsing a rapidjson document first
+        bool Streaming = true;
+    };
+
+    /// Reads an hp json ast into header files. Errors are thrown as std::string.
+    class AstLoader
+    {
+    public:
+        AstLoader(const LoaderOptions& options);
+
+        /// Appends the files of InputFile to OutFiles, returns false if the file could not be opened
+        bool Load(const std::string& InputFile, std::vector<HeaderFile>& OutFiles);
+
+        /// The file being loaded, for error messages
+        const std::string& CurrentFile() const { return Current; }
+
+    private:
+        struct Impl;
+        friend struct Impl;
+
+        LoaderOptions Options;
+        std::string Current;
+    };
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace lab
+{
+    enum class NodeKind : uint8_t
+    {
+        Namespace,
+        Class,
+        Enum,
+        EnumValue,
+        Function,
+        Data,
+        Constructor
+    };
+
+    enum class FunctionType : uint8_t
+    {
+        Common,
+        Static,
+        Global,
+        Property
+    };
+
+    /// One declaration of the ast. Which fields are meaningful depends on Kind.
+    struct Node
+    {
+        NodeKind Kind;
+        FunctionType Function = FunctionType::Common;
+        bool IsCFunction = false;
+        bool ShouldExport = false;
+        bool Writeable = false;
+        bool IsStatic = false;
+        bool IsAutoNull = false;
+        /// Const member function
+        bool IsConst = false;
+        /// Virtual member function
+        bool IsVirtual = false;
+        /// Class stored inline in its userdata, LUA_CLASS(value)
+        bool IsValue = false;
+        /// Function also bound over arrays of arguments, LUA_FUNCTION(batch)
+        bool IsBatch = false;
+
+        std::string Name;
+        std::string ExportName;
+
+        /// Setter of a property function, parent of a class or parameter list of a constructor
+        std::string Detail;
+        /// Declared type of a data member, or return and parameter types of a function
+        std::string Signature;
+        std::string Comment;
+
+        /// Members of a namespace or class, values of an enum
+        std::vector<Node> Children;
+
+        explicit Node(NodeKind kind) : Kind(kind) {}
+
+        const std::string& GetExportName() const
+        {
+            return ExportName.empty() ? Name : ExportName;
+        }
+    };
+
+    struct HeaderFile
+    {
+        std::string Name;
+        std::vector<std::string> IncludeFiles;
+        std::vector<Node> Nodes;
+    };
+}
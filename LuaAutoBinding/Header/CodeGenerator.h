@@ -10,13 +10,139 @@ public:
     CodeGenerator();
     ~CodeGenerator();
 
+    enum class ASTLoader
+    {
+        // Builds the model from rapidjson reader events while the file is read
+        Streaming,
+        // Parses the file into a rapidjson document first, then copies it into the model
+        Document
+    };
+
+    enum class ThunkMode
+    {
+        // Every function goes through the luaportal chain, which instantiates a call proxy per function
+        Portal,
+        // Functions are bound after the chain through lab/Thunk.h, one thunk per function type with the function as upvalue
+        Shared,
+        // Every function gets a generated lua_CFunction converting its arguments inline, bound through lab/Direct.h
+        Direct,
+        // As Direct, property getters and setters included, with each class installed from static luaL_Reg arrays
+        Table
+    };
+
+    enum class DataMode
+    {
+        // Every data member goes through the luaportal chain, which instantiates accessors per member
+        Portal,
+        // Non static members of plain types of classes without a parent go into a per class table of offsets read by the
+        // accessors of lab/Field.h, those classes must be standard layout
+        Offset
+    };
+
+    enum class RegisterMode
+    {
+        // RegisterAPIs builds every namespace, class and enum of the ast
+        Eager,
+        // Top level namespaces are only built when a script first reads or requires them, through lab/Module.h
+        Lazy
+    };
+
+    enum class IndexMode
+    {
+        // Members are looked up by luaportal's __index and __newindex
+        Portal,
+        // Each class gets a perfect hash over its members in front of luaportal's lookup, needs ThunkMode::Table and no previous ast
+        Hash
+    };
+
+    enum class InheritMode
+    {
+        // Inherited members are found by walking up the parent classes on every lookup
+        Chain,
+        // Inherited methods and properties are copied into every derived class at registration
+        Flatten
+    };
+
+    enum class PointerMode
+    {
+        // Every pushed pointer becomes a new userdata
+        New,
+        // Pointers to bound classes returned by generated thunks reuse the userdata of the same object, needs ThunkMode::Direct or ThunkMode::Table
+        Cached
+    };
+
+    enum class StringMode
+    {
+        // A const std::string& argument is a new std::string per call
+        Copy,
+        // A const std::string& argument reuses a buffer of lab/Direct.h, needs ThunkMode::Direct or ThunkMode::Table
+        Reuse
+    };
+
+    enum class EnumMode
+    {
+        // Enums are built through the luaportal chain one value at a time
+        Portal,
+        // Enums are tables created at their final size by lab/Enum.h
+        Sized
+    };
+
+    enum class FfiMode
+    {
+        // Functions are only reachable through the lua C api
+        Off,
+        // Functions whose types are plain values also get an extern "C" shim for LuaJIT's FFI, see GetFfiModule
+        Shims
+    };
+
+    enum class ProfileMode
+    {
+        // Thunks only call the function
+        Off,
+        // Every generated thunk counts its calls and their times through lab/Profile.h, needs ThunkMode::Direct or ThunkMode::Table
+        Calls
+    };
+
+    /// Can be called once per ast, the headers of all of them are generated together
     bool ParseAST(const std::string& InputFile);
 
+    /// Loads the ast the running process was generated from, can be called once per ast.
+    /// The result then also defines RegisterAPIsDelta, which registers only what changed since then into an existing state.
+    bool ParsePreviousAST(const std::string& InputFile);
+
     std::string GetResult();
 
+    struct Shard
+    {
+        // Identifier made from the first header of the shard, used in file and function names
+        std::string Name;
+        std::string Code;
+    };
+
+    /// Splits the output into one translation unit per FilesPerShard headers.
+    /// The first element is the root unit: its Name is empty and its RegisterAPIs calls the shards in include order.
+    std::vector<Shard> GetShardedResult(size_t FilesPerShard);
+
+    /// LuaJIT module declaring the shims of FfiMode::Shims through ffi.cdef and wrapping them by lua path.
+    /// Call after GetResult or GetShardedResult.
+    std::string GetFfiModule();
+
     std::string AutoNullMacro;
     std::string FunctionPropertyMacro;
     std::string CFunctionMacro;
+    ASTLoader Loader = ASTLoader::Streaming;
+    // Threads used to generate headers, 0 uses one per hardware thread. The output does not depend on it.
+    unsigned Jobs = 0;
+    ThunkMode Thunks = ThunkMode::Portal;
+    DataMode Data = DataMode::Portal;
+    RegisterMode Register = RegisterMode::Eager;
+    IndexMode Index = IndexMode::Portal;
+    InheritMode Inherit = InheritMode::Chain;
+    PointerMode Pointers = PointerMode::New;
+    StringMode Strings = StringMode::Copy;
+    EnumMode Enums = EnumMode::Portal;
+    FfiMode Ffi = FfiMode::Off;
+    ProfileMode Profile = ProfileMode::Off;
 
 private:
     struct Impl;
@@ -0,0 +1,249 @@
+#pragma once
+
+// Support for generated lua_CFunctions. lab writes one thunk per bound function with the argument conversions
+// inlined, this header only registers them and converts the types lab does not inline. Thunks are bound one at
+// a time, or a whole table of a class at once from a static luaL_Reg array.
+
+#include "Thunk.h"
+
+#include <cstddef>
+#include <initializer_list>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#include <string_view>
+#define LAB_STRING_VIEW 1
+#endif
+
+namespace lab
+{
+    /// Type of parameter I of a function or method pointer type
+    template <class Fn, size_t I>
+    struct ArgumentOf;
+
+    template <class R, class... A, size_t I>
+    struct ArgumentOf<R (*)(A...), I>
+    {
+        typedef typename std::tuple_element<I, std::tuple<A...>>::type Type;
+    };
+
+    template <class T, class R, class... A, size_t I>
+    struct ArgumentOf<R (T::*)(A...), I>
+    {
+        typedef typename std::tuple_element<I, std::tuple<A...>>::type Type;
+    };
+
+    template <class T, class R, class... A, size_t I>
+    struct ArgumentOf<R (T::*)(A...) const, I>
+    {
+        typedef typename std::tuple_element<I, std::tuple<A...>>::type Type;
+    };
+
+    namespace direct
+    {
+        /// Argument Index as a string, embedded zeros included
+        inline std::string ToString(lua_State* L, int Index)
+        {
+            size_t Length = 0;
+            auto Value = luaL_checklstring(L, Index, &Length);
+            return std::string(Value, Length);
+        }
+
+        inline void PushString(lua_State* L, const std::string& Value)
+        {
+            lua_pushlstring(L, Value.data(), Value.size());
+        }
+
+#ifdef LAB_STRING_VIEW
+        /// Argument Index as a view of the lua string, valid while the string stays on the stack
+        inline std::string_view ToStringView(lua_State* L, int Index)
+        {
+            size_t Length = 0;
+            auto Value = luaL_checklstring(L, Index, &Length);
+            return std::string_view(Value, Length);
+        }
+
+        inline void PushString(lua_State* L, std::string_view Value)
+        {
+            lua_pushlstring(L, Value.data(), Value.size());
+        }
+#endif
+
+        /// Buffers given up by finished calls, kept per thread so their capacity serves the next ones
+        inline std::vector<std::string>& SpareStrings()
+        {
+            static thread_local std::vector<std::string> Spare;
+            return Spare;
+        }
+
+        /// The const std::string& arguments of one call. Each takes a spare buffer and gives it back when the call
+        /// returns, so an argument only allocates while no buffer of its length was used before on the thread.
+        /// Nested and recursive calls take their own buffers.
+        template <size_t N>
+        class StringArguments
+        {
+        public:
+            StringArguments() = default;
+            StringArguments(const StringArguments&) = delete;
+            StringArguments& operator=(const StringArguments&) = delete;
+
+            ~StringArguments()
+            {
+                auto& Spare = SpareStrings();
+                for (size_t i = 0; i < Used; ++i)
+                {
+                    Spare.push_back(std::move(Items[i]));
+                }
+            }
+
+            const std::string& Get(lua_State* L, int Index)
+            {
+                size_t Length = 0;
+                auto Value = luaL_checklstring(L, Index, &Length);
+                auto& Item = Items[Used++];
+                auto& Spare = SpareStrings();
+                if (!Spare.empty())
+                {
+                    Item = std::move(Spare.back());
+                    Spare.pop_back();
+                }
+                Item.assign(Value, Length);
+                return Item;
+            }
+
+        private:
+            std::string Items[N];
+            size_t Used = 0;
+        };
+
+        inline void SetFunction(lua_State* L, const char* Name, lua_CFunction Function)
+        {
+            lua_pushcfunction(L, Function);
+            detail::SetField(L, -2, Name);
+            lua_pop(L, 1);
+        }
+    }
+
+    namespace batch
+    {
+        /// Common length of the arrays at 1 to Arrays, raising a lua error unless each is a table of that length.
+        /// Drops extra arguments so the elements pushed after the arrays land at known indices.
+        inline lua_Integer CheckCount(lua_State* L, int Arrays)
+        {
+            lua_Integer Count = 0;
+            for (int i = 1; i <= Arrays; ++i)
+            {
+                luaL_checktype(L, i, LUA_TTABLE);
+                auto Length = static_cast<lua_Integer>(lua_rawlen(L, i));
+                if (i > 1 && Length != Count)
+                {
+                    luaL_argerror(L, i, lua_pushfstring(L, "array of %I elements expected, got %I", Count, Length));
+                }
+                Count = Length;
+            }
+            lua_settop(L, Arrays);
+            return Count;
+        }
+
+        /// Pushes element Item of each array at 1 to Arrays
+        inline void PushItems(lua_State* L, int Arrays, lua_Integer Item)
+        {
+            luaL_checkstack(L, Arrays + 1, nullptr);
+            for (int i = 1; i <= Arrays; ++i)
+            {
+                lua_rawgeti(L, i, Item);
+            }
+        }
+    }
+
+    /// The tables of a class a luaL_Reg array can be installed into
+    enum class ClassTable
+    {
+        Methods,
+        ConstMethods,
+        Statics,
+        Getters,
+        ConstGetters,
+        Setters
+    };
+
+    template <class T>
+    inline void PushClassTable(lua_State* L, ClassTable Table)
+    {
+        switch (Table)
+        {
+        case ClassTable::Methods:
+            portal::PushClassTable<T>(L);
+            break;
+        case ClassTable::ConstMethods:
+            portal::PushConstTable<T>(L);
+            break;
+        case ClassTable::Statics:
+            portal::PushStaticTable<T>(L);
+            break;
+        case ClassTable::Getters:
+        case ClassTable::ConstGetters:
+            portal::PushGetterTable<T>(L, Table == ClassTable::ConstGetters);
+            break;
+        case ClassTable::Setters:
+            portal::PushSetterTable<T>(L);
+            break;
+        }
+    }
+
+    /// Installs a null terminated array of thunks into one table of T in a single pass
+    template <class T>
+    inline void SetFunctions(lua_State* L, ClassTable Table, const luaL_Reg* Functions)
+    {
+        PushClassTable<T>(L, Table);
+        luaL_setfuncs(L, Functions, 0);
+        lua_pop(L, 1);
+    }
+
+    /// Binds a generated thunk as a method of T, const methods are also reachable from const objects
+    template <class T>
+    inline void BindCMethod(lua_State* L, const char* Name, lua_CFunction Thunk, bool Const)
+    {
+        portal::PushClassTable<T>(L);
+        direct::SetFunction(L, Name, Thunk);
+        if (Const)
+        {
+            portal::PushConstTable<T>(L);
+            direct::SetFunction(L, Name, Thunk);
+        }
+    }
+
+    /// Binds generated getter and setter thunks as a property of T, the getter also serves const objects. Set is null
+    /// for a read only property.
+    template <class T>
+    inline void BindCProperty(lua_State* L, const char* Name, lua_CFunction Get, lua_CFunction Set)
+    {
+        for (auto Const : { false, true })
+        {
+            portal::PushGetterTable<T>(L, Const);
+            direct::SetFunction(L, Name, Get);
+        }
+        if (Set)
+        {
+            portal::PushSetterTable<T>(L);
+            direct::SetFunction(L, Name, Set);
+        }
+    }
+
+    /// Binds a generated thunk as a static function of T
+    template <class T>
+    inline void BindCStatic(lua_State* L, const char* Name, lua_CFunction Thunk)
+    {
+        portal::PushStaticTable<T>(L);
+        direct::SetFunction(L, Name, Thunk);
+    }
+
+    /// Binds a generated thunk into the namespace at Path
+    inline void BindCFunction(lua_State* L, const char* Path, const char* Name, lua_CFunction Thunk)
+    {
+        PushNamespace(L, Path);
+        direct::SetFunction(L, Name, Thunk);
+    }
+}
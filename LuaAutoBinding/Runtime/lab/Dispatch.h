@@ -0,0 +1,165 @@
+#pragma once
+
+// Member lookup through a perfect hash. lab knows every member of a class, so it picks a seed under which their names
+// land in distinct slots of a static table. __index and __newindex of the class then hash the key, compare one name
+// and call the thunk, and only keys that are not members go through luaportal's lookup.
+
+#include "Direct.h"
+
+#include <cstdint>
+#include <cstring>
+
+namespace lab
+{
+    enum class IndexKind : uint8_t
+    {
+        // Reading the key returns Get as a function
+        Method,
+        // Reading the key calls Get with the object, writing it calls Set with the object and the value
+        Property
+    };
+
+    struct IndexEntry
+    {
+        const char* Name;
+        uint32_t Length;
+        IndexKind Kind;
+        lua_CFunction Get;
+        lua_CFunction Set;
+    };
+
+    struct IndexTable
+    {
+        uint32_t Seed;
+        // Slot count minus one, the slot count is a power of two
+        uint32_t Mask;
+        // Hash every character instead of the length and three of them
+        bool Full;
+        const IndexEntry* Entries;
+    };
+
+    namespace detail
+    {
+        // lab computes the same hash when it picks the seed, the two have to stay identical
+        inline uint32_t HashKey(const char* Key, size_t Length, uint32_t Seed, bool Full)
+        {
+            uint32_t Hash = Seed;
+            auto Mix = [&Hash](unsigned char c) {
+                Hash ^= c;
+                Hash *= 16777619u;
+            };
+            if (Full)
+            {
+                for (size_t i = 0; i < Length; ++i)
+                {
+                    Mix(static_cast<unsigned char>(Key[i]));
+                }
+            }
+            else if (Length > 0)
+            {
+                Mix(static_cast<unsigned char>(Key[0]));
+                Mix(static_cast<unsigned char>(Key[Length / 2]));
+                Mix(static_cast<unsigned char>(Key[Length - 1]));
+            }
+            Mix(static_cast<unsigned char>(Length));
+            Hash ^= Hash >> 15;
+            Hash *= 0x2c1b3c6du;
+            Hash ^= Hash >> 12;
+            return Hash;
+        }
+
+        inline const IndexEntry* FindEntry(lua_State* L, const IndexTable& Table)
+        {
+            if (lua_type(L, 2) != LUA_TSTRING)
+            {
+                return nullptr;
+            }
+            size_t Length = 0;
+            auto Key = lua_tolstring(L, 2, &Length);
+            auto& Entry = Table.Entries[HashKey(Key, Length, Table.Seed, Table.Full) & Table.Mask];
+            if (Entry.Name && Entry.Length == Length && std::memcmp(Entry.Name, Key, Length) == 0)
+            {
+                return &Entry;
+            }
+            return nullptr;
+        }
+
+        // Calls the metamethod that was replaced, a function or a table as luaportal left it, with the arguments
+        inline int Fallback(lua_State* L, int Arguments, int Results)
+        {
+            if (lua_isfunction(L, lua_upvalueindex(2)))
+            {
+                lua_pushvalue(L, lua_upvalueindex(2));
+                lua_insert(L, 1);
+                lua_call(L, Arguments, Results);
+                return Results;
+            }
+            if (lua_istable(L, lua_upvalueindex(2)))
+            {
+                if (Results == 0)
+                {
+                    lua_settable(L, lua_upvalueindex(2));
+                    return 0;
+                }
+                lua_gettable(L, lua_upvalueindex(2));
+                return 1;
+            }
+            lua_pushnil(L);
+            return Results;
+        }
+
+        inline int Index(lua_State* L)
+        {
+            auto Entry = FindEntry(L, *static_cast<const IndexTable*>(lua_touserdata(L, lua_upvalueindex(1))));
+            if (!Entry)
+            {
+                lua_settop(L, 2);
+                return Fallback(L, 2, 1);
+            }
+            if (Entry->Kind == IndexKind::Method)
+            {
+                lua_pushcfunction(L, Entry->Get);
+                return 1;
+            }
+            lua_settop(L, 1);
+            return Entry->Get(L);
+        }
+
+        inline int NewIndex(lua_State* L)
+        {
+            auto Entry = FindEntry(L, *static_cast<const IndexTable*>(lua_touserdata(L, lua_upvalueindex(1))));
+            if (!Entry || !Entry->Set)
+            {
+                lua_settop(L, 3);
+                return Fallback(L, 3, 0);
+            }
+            lua_remove(L, 2);
+            Entry->Set(L);
+            return 0;
+        }
+
+        // Wraps the metamethod Name of the table on top of the stack
+        inline void SetDispatch(lua_State* L, const char* Name, const IndexTable* Table, lua_CFunction Dispatch)
+        {
+            lua_pushstring(L, Name);
+            lua_pushlightuserdata(L, const_cast<IndexTable*>(Table));
+            lua_pushstring(L, Name);
+            lua_rawget(L, -4);
+            lua_pushcclosure(L, Dispatch, 2);
+            lua_rawset(L, -3);
+        }
+    }
+
+    /// Puts the perfect hash lookup in front of luaportal's __index of T and of its const objects, and its __newindex
+    template <class T>
+    inline void BindIndex(lua_State* L, const IndexTable* Table, const IndexTable* ConstTable)
+    {
+        portal::PushClassTable<T>(L);
+        detail::SetDispatch(L, "__index", Table, &detail::Index);
+        detail::SetDispatch(L, "__newindex", Table, &detail::NewIndex);
+        lua_pop(L, 1);
+        portal::PushConstTable<T>(L);
+        detail::SetDispatch(L, "__index", ConstTable, &detail::Index);
+        lua_pop(L, 1);
+    }
+}
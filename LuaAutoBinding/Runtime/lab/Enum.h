@@ -0,0 +1,79 @@
+#pragma once
+
+// Enums as one table each, created at the size lab counted and filled in a single pass. Through the luaportal chain
+// the table grows, and rehashes, with every value added.
+
+#include "Thunk.h"
+
+namespace lab
+{
+    struct EnumValue
+    {
+        const char* Name;
+        lua_Integer Value;
+    };
+
+    namespace detail
+    {
+        // Registry key of the metatable every enum table of a state shares
+        inline void* EnumKey()
+        {
+            static char Key;
+            return &Key;
+        }
+
+        inline int AddEnumValue(lua_State* L)
+        {
+            return luaL_error(L, "can not add %s to an enum", luaL_tolstring(L, 2, nullptr));
+        }
+
+        // Values can not be added, and the metatable can not be replaced from lua
+        inline void PushEnumMetatable(lua_State* L)
+        {
+            lua_rawgetp(L, LUA_REGISTRYINDEX, EnumKey());
+            if (!lua_isnil(L, -1))
+            {
+                return;
+            }
+            lua_pop(L, 1);
+            lua_createtable(L, 0, 2);
+            lua_pushcfunction(L, &AddEnumValue);
+            lua_setfield(L, -2, "__newindex");
+            lua_pushliteral(L, "enum");
+            lua_setfield(L, -2, "__metatable");
+            lua_pushvalue(L, -1);
+            lua_rawsetp(L, LUA_REGISTRYINDEX, EnumKey());
+        }
+
+        inline void PushEnum(lua_State* L, const EnumValue* Values, int Count)
+        {
+            lua_createtable(L, 0, Count);
+            for (int i = 0; i < Count; ++i)
+            {
+                lua_pushinteger(L, Values[i].Value);
+                lua_setfield(L, -2, Values[i].Name);
+            }
+            PushEnumMetatable(L);
+            lua_setmetatable(L, -2);
+        }
+    }
+
+    /// Sets Name in the namespace at Path to a table of the Count values
+    inline void BindEnum(lua_State* L, const char* Path, const char* Name, const EnumValue* Values, int Count)
+    {
+        PushNamespace(L, Path);
+        detail::PushEnum(L, Values, Count);
+        detail::SetField(L, -2, Name);
+        lua_pop(L, 1);
+    }
+
+    /// Sets Name in the static table of T to a table of the Count values
+    template <class T>
+    inline void BindClassEnum(lua_State* L, const char* Name, const EnumValue* Values, int Count)
+    {
+        portal::PushStaticTable<T>(L);
+        detail::PushEnum(L, Values, Count);
+        detail::SetField(L, -2, Name);
+        lua_pop(L, 1);
+    }
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+// Support for LuaJIT FFI shims. lab writes an extern "C" function for every function whose types are plain values,
+// and a lua module that declares them to ffi.cdef, so compiled traces call them without the lua C api. Methods take
+// the object as a pointer, which a script gets once through the FfiAddress function of the class. The shims have to
+// be visible to ffi.C, link executables with -rdynamic or the platform's equivalent. Only compiled traces gain: the
+// interpreter calls a shim several times slower than the lua C api thunk of the same function. LuaJIT speaks the lua
+// 5.1 api, so this file uses nothing newer and only includes Portal.h, which keeps to it as well.
+
+#include "Portal.h"
+
+#include <cstdint>
+
+#if defined(_WIN32)
+#define LAB_FFI_EXPORT __declspec(dllexport)
+#else
+#define LAB_FFI_EXPORT __attribute__((visibility("default")))
+#endif
+
+namespace lab
+{
+    namespace detail
+    {
+        template <class T>
+        inline int PushAddress(lua_State* L)
+        {
+            lua_pushlightuserdata(L, const_cast<T*>(portal::GetObject<T>(L, 1, true)));
+            return 1;
+        }
+    }
+
+    /// Binds FfiAddress(object) into the static table of T. The pointer it returns is only valid while the object
+    /// lives, and the shims check neither its type nor its constness.
+    template <class T>
+    inline void BindAddress(lua_State* L)
+    {
+        portal::PushStaticTable<T>(L);
+        lua_pushcfunction(L, &detail::PushAddress<T>);
+        lua_setfield(L, -2, "FfiAddress");
+        lua_pop(L, 1);
+    }
+}
@@ -0,0 +1,275 @@
+#pragma once
+
+// Offset based data members. A class lists its fields in a static table of byte offsets and type tags,
+// and every field of every class is read and written by the same two lua_CFunctions.
+
+/// Byte offset of Member in the class lab::MakeField is given, as a generic lambda so offsetof is only
+/// instantiated for standard layout classes, the only ones it is defined for
+#define LAB_FIELD_OFFSET(Member) [](auto Type) { return offsetof(typename decltype(Type)::Type, Member); }
+
+#include "Portal.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace lab
+{
+    enum class FieldType : uint8_t
+    {
+        Bool,
+        Int8,
+        UInt8,
+        Int16,
+        UInt16,
+        Int32,
+        UInt32,
+        Int64,
+        UInt64,
+        Float,
+        Double,
+        String
+    };
+
+    /// Tag of a field type, only defined for the types the shared accessors handle
+    template <class F, class Enable = void>
+    struct FieldTypeOf
+    {
+    };
+
+    template <>
+    struct FieldTypeOf<bool>
+    {
+        static const FieldType Value = FieldType::Bool;
+    };
+
+    template <class F>
+    struct FieldTypeOf<F, typename std::enable_if<std::is_integral<F>::value && !std::is_same<F, bool>::value>::type>
+    {
+        static const FieldType Value =
+            sizeof(F) == 1 ? (std::is_signed<F>::value ? FieldType::Int8 : FieldType::UInt8) :
+            sizeof(F) == 2 ? (std::is_signed<F>::value ? FieldType::Int16 : FieldType::UInt16) :
+            sizeof(F) == 4 ? (std::is_signed<F>::value ? FieldType::Int32 : FieldType::UInt32) :
+            (std::is_signed<F>::value ? FieldType::Int64 : FieldType::UInt64);
+    };
+
+    template <>
+    struct FieldTypeOf<float>
+    {
+        static const FieldType Value = FieldType::Float;
+    };
+
+    template <>
+    struct FieldTypeOf<double>
+    {
+        static const FieldType Value = FieldType::Double;
+    };
+
+    template <>
+    struct FieldTypeOf<std::string>
+    {
+        static const FieldType Value = FieldType::String;
+    };
+
+    /// Returns the object at Index as a T*, or the field itself when Offset is 0 and the class is not standard layout,
+    /// checked the way luaportal checks method calls
+    typedef void* (*ObjectGetter)(lua_State* L, int Index, bool Const);
+
+    struct Field
+    {
+        const char* Name;
+        std::size_t Offset;
+        FieldType Type;
+        bool Writeable;
+        ObjectGetter Object;
+    };
+
+    namespace detail
+    {
+        template <class T>
+        void* GetObjectPointer(lua_State* L, int Index, bool Const)
+        {
+            return const_cast<void*>(static_cast<const void*>(portal::GetObject<T>(L, Index, Const)));
+        }
+
+        template <class T, class F, F T::* Member>
+        void* GetMemberPointer(lua_State* L, int Index, bool Const)
+        {
+            return const_cast<void*>(static_cast<const void*>(&(portal::GetObject<T>(L, Index, Const)->*Member)));
+        }
+
+        template <class T>
+        struct FieldClass
+        {
+            typedef T Type;
+        };
+
+        template <class T, class F, F T::* Member, class OffsetOf>
+        inline Field MakeField(const char* Name, OffsetOf Offset, bool Writeable, std::true_type)
+        {
+            typedef typename std::remove_cv<F>::type Value;
+            return Field{ Name, Offset(FieldClass<T>()), FieldTypeOf<Value>::Value, Writeable && !std::is_const<F>::value, &GetObjectPointer<T> };
+        }
+
+        // One accessor per member instead of per class, still a single indirect call per access
+        template <class T, class F, F T::* Member, class OffsetOf>
+        inline Field MakeField(const char* Name, OffsetOf, bool Writeable, std::false_type)
+        {
+            typedef typename std::remove_cv<F>::type Value;
+            return Field{ Name, 0, FieldTypeOf<Value>::Value, Writeable && !std::is_const<F>::value, &GetMemberPointer<T, F, Member> };
+        }
+
+        template <class F>
+        inline void PushValue(lua_State* L, const void* Address)
+        {
+            lua_pushinteger(L, static_cast<lua_Integer>(*static_cast<const F*>(Address)));
+        }
+
+        template <class F>
+        inline void ReadValue(lua_State* L, int Index, void* Address)
+        {
+            *static_cast<F*>(Address) = static_cast<F>(luaL_checkinteger(L, Index));
+        }
+
+        inline int GetField(lua_State* L)
+        {
+            auto& Info = *static_cast<const Field*>(lua_touserdata(L, lua_upvalueindex(1)));
+            auto Address = static_cast<const char*>(Info.Object(L, 1, true)) + Info.Offset;
+            switch (Info.Type)
+            {
+            case FieldType::Bool:
+                lua_pushboolean(L, *reinterpret_cast<const bool*>(Address));
+                break;
+            case FieldType::Int8:
+                PushValue<int8_t>(L, Address);
+                break;
+            case FieldType::UInt8:
+                PushValue<uint8_t>(L, Address);
+                break;
+            case FieldType::Int16:
+                PushValue<int16_t>(L, Address);
+                break;
+            case FieldType::UInt16:
+                PushValue<uint16_t>(L, Address);
+                break;
+            case FieldType::Int32:
+                PushValue<int32_t>(L, Address);
+                break;
+            case FieldType::UInt32:
+                PushValue<uint32_t>(L, Address);
+                break;
+            case FieldType::Int64:
+                PushValue<int64_t>(L, Address);
+                break;
+            case FieldType::UInt64:
+                PushValue<uint64_t>(L, Address);
+                break;
+            case FieldType::Float:
+                lua_pushnumber(L, *reinterpret_cast<const float*>(Address));
+                break;
+            case FieldType::Double:
+                lua_pushnumber(L, *reinterpret_cast<const double*>(Address));
+                break;
+            case FieldType::String:
+            {
+                auto& Value = *reinterpret_cast<const std::string*>(Address);
+                lua_pushlstring(L, Value.data(), Value.size());
+                break;
+            }
+            }
+            return 1;
+        }
+
+        inline int SetField(lua_State* L)
+        {
+            auto& Info = *static_cast<const Field*>(lua_touserdata(L, lua_upvalueindex(1)));
+            auto Address = static_cast<char*>(Info.Object(L, 1, false)) + Info.Offset;
+            switch (Info.Type)
+            {
+            case FieldType::Bool:
+                *reinterpret_cast<bool*>(Address) = lua_toboolean(L, 2) != 0;
+                break;
+            case FieldType::Int8:
+                ReadValue<int8_t>(L, 2, Address);
+                break;
+            case FieldType::UInt8:
+                ReadValue<uint8_t>(L, 2, Address);
+                break;
+            case FieldType::Int16:
+                ReadValue<int16_t>(L, 2, Address);
+                break;
+            case FieldType::UInt16:
+                ReadValue<uint16_t>(L, 2, Address);
+                break;
+            case FieldType::Int32:
+                ReadValue<int32_t>(L, 2, Address);
+                break;
+            case FieldType::UInt32:
+                ReadValue<uint32_t>(L, 2, Address);
+                break;
+            case FieldType::Int64:
+                ReadValue<int64_t>(L, 2, Address);
+                break;
+            case FieldType::UInt64:
+                ReadValue<uint64_t>(L, 2, Address);
+                break;
+            case FieldType::Float:
+                *reinterpret_cast<float*>(Address) = static_cast<float>(luaL_checknumber(L, 2));
+                break;
+            case FieldType::Double:
+                *reinterpret_cast<double*>(Address) = static_cast<double>(luaL_checknumber(L, 2));
+                break;
+            case FieldType::String:
+            {
+                size_t Length = 0;
+                auto Value = luaL_checklstring(L, 2, &Length);
+                reinterpret_cast<std::string*>(Address)->assign(Value, Length);
+                break;
+            }
+            }
+            return 0;
+        }
+
+        inline void SetAccessor(lua_State* L, const Field& Info, lua_CFunction Accessor)
+        {
+            lua_pushstring(L, Info.Name);
+            lua_pushlightuserdata(L, const_cast<Field*>(&Info));
+            lua_pushcclosure(L, Accessor, 1);
+            lua_rawset(L, -3);
+        }
+    }
+
+    /// Describes member Member of T, the generated code passes LAB_FIELD_OFFSET(Member) as Offset.
+    /// Standard layout classes share one accessor per class and read the field at its offset, the others get one
+    /// accessor per member, so a class with private data or virtual functions still binds.
+    template <class T, class F, F T::* Member, class OffsetOf>
+    inline Field MakeField(const char* Name, OffsetOf Offset, bool Writeable)
+    {
+        return detail::MakeField<T, F, Member>(Name, Offset, Writeable, std::is_standard_layout<T>());
+    }
+
+    /// Binds every field of a static table as a property of T
+    template <class T, std::size_t N>
+    inline void BindFields(lua_State* L, const Field (&Fields)[N])
+    {
+        for (auto Const : { false, true })
+        {
+            portal::PushGetterTable<T>(L, Const);
+            for (auto& Info : Fields)
+            {
+                detail::SetAccessor(L, Info, &detail::GetField);
+            }
+            lua_pop(L, 1);
+        }
+        portal::PushSetterTable<T>(L);
+        for (auto& Info : Fields)
+        {
+            if (Info.Writeable)
+            {
+                detail::SetAccessor(L, Info, &detail::SetField);
+            }
+        }
+        lua_pop(L, 1);
+    }
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+// Object identity for pushed pointers. luaportal makes a new userdata every time a pointer is pushed, so the same
+// C++ object reaches lua as many objects that compare unequal and all have to be collected. The cache maps the
+// address and class of a pushed object to its userdata for as long as lua holds on to it.
+
+#include "Portal.h"
+
+#include <type_traits>
+
+namespace lab
+{
+    namespace detail
+    {
+        // Registry key of the cache: class key to a weak valued table of address to userdata
+        inline void* IdentityKey()
+        {
+            static char Key;
+            return &Key;
+        }
+
+        // Pushes the cache of the class at ClassKey, creating it on first use
+        inline void PushIdentityCache(lua_State* L, const void* ClassKey)
+        {
+            if (lua_rawgetp(L, LUA_REGISTRYINDEX, IdentityKey()) == LUA_TNIL)
+            {
+                lua_pop(L, 1);
+                lua_newtable(L);
+                lua_pushvalue(L, -1);
+                lua_rawsetp(L, LUA_REGISTRYINDEX, IdentityKey());
+            }
+            if (lua_rawgetp(L, -1, ClassKey) == LUA_TNIL)
+            {
+                lua_pop(L, 1);
+                lua_newtable(L);
+                lua_createtable(L, 0, 1);
+                lua_pushliteral(L, "v");
+                lua_setfield(L, -2, "__mode");
+                lua_setmetatable(L, -2);
+                lua_pushvalue(L, -1);
+                lua_rawsetp(L, -3, ClassKey);
+            }
+            lua_remove(L, -2);
+        }
+    }
+
+    /// Pushes Object, reusing the userdata of an earlier push of the same object while lua still references it
+    template <class T>
+    inline void PushObject(lua_State* L, T* Object)
+    {
+        if (!Object)
+        {
+            lua_pushnil(L);
+            return;
+        }
+        typedef typename std::remove_const<T>::type Class;
+        detail::PushIdentityCache(L, portal::GetClassKey<Class>(std::is_const<T>::value));
+        auto Address = const_cast<void*>(static_cast<const void*>(Object));
+        if (lua_rawgetp(L, -1, Address) != LUA_TNIL)
+        {
+            lua_remove(L, -2);
+            return;
+        }
+        lua_pop(L, 1);
+        portal::Push(L, Object);
+        lua_pushvalue(L, -1);
+        lua_rawsetp(L, -3, Address);
+        lua_remove(L, -2);
+    }
+
+    /// Drops Object from the cache of every class, call it when the object is destroyed so an object later
+    /// allocated at the same address gets a userdata of its own. Userdata already in lua keep their pointer.
+    inline void ForgetObject(lua_State* L, const void* Object)
+    {
+        if (lua_rawgetp(L, LUA_REGISTRYINDEX, detail::IdentityKey()) == LUA_TNIL)
+        {
+            lua_pop(L, 1);
+            return;
+        }
+        auto Address = const_cast<void*>(Object);
+        for (lua_pushnil(L); lua_next(L, -2); lua_pop(L, 1))
+        {
+            lua_pushnil(L);
+            lua_rawsetp(L, -2, Address);
+        }
+        lua_pop(L, 1);
+    }
+
+    /// Empties the cache, for when objects are destroyed in bulk
+    inline void ClearObjects(lua_State* L)
+    {
+        lua_pushnil(L);
+        lua_rawsetp(L, LUA_REGISTRYINDEX, detail::IdentityKey());
+    }
+}
@@ -0,0 +1,257 @@
+#pragma once
+
+// Flattened inheritance. luaportal looks a member up in the class of the object and walks to the parent class on
+// every miss, so an inherited member costs one lookup per level. Flattening copies what a class inherits into its
+// own tables once at registration, after which a member is found in the first table at any depth.
+
+#include "Portal.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <new>
+
+namespace lab
+{
+    /// What flattening cost a state so far
+    struct FlattenMetrics
+    {
+        size_t Classes;
+        // Table entries added from parents
+        size_t Entries;
+        uint64_t Nanoseconds;
+        // Growth of the lua heap while copying, entries included
+        size_t Bytes;
+    };
+
+    namespace detail
+    {
+        // Registry key of the flattening state: [1] the array of copied table pairs, [2] for each child table the
+        // keys it got from its parent, [3] the metrics
+        inline void* FlattenKey()
+        {
+            static char Key;
+            return &Key;
+        }
+
+        inline void PushFlattenState(lua_State* L)
+        {
+            lua_rawgetp(L, LUA_REGISTRYINDEX, FlattenKey());
+            if (!lua_isnil(L, -1))
+            {
+                return;
+            }
+            lua_pop(L, 1);
+            lua_createtable(L, 3, 0);
+            lua_newtable(L);
+            lua_rawseti(L, -2, 1);
+            lua_newtable(L);
+            lua_rawseti(L, -2, 2);
+            new (lua_newuserdata(L, sizeof(FlattenMetrics))) FlattenMetrics{ 0, 0, 0, 0 };
+            lua_rawseti(L, -2, 3);
+            lua_pushvalue(L, -1);
+            lua_rawsetp(L, LUA_REGISTRYINDEX, FlattenKey());
+        }
+
+        inline FlattenMetrics& GetFlattenMetrics(lua_State* L, int State)
+        {
+            lua_rawgeti(L, State, 3);
+            auto Metrics = static_cast<FlattenMetrics*>(lua_touserdata(L, -1));
+            lua_pop(L, 1);
+            return *Metrics;
+        }
+
+        inline size_t HeapBytes(lua_State* L)
+        {
+            return static_cast<size_t>(lua_gc(L, LUA_GCCOUNT, 0)) * 1024 + static_cast<size_t>(lua_gc(L, LUA_GCCOUNTB, 0));
+        }
+
+        // Whether Key of a class or const table is a member, the rest are metamethods and luaportal's own entries
+        inline bool IsMemberKey(lua_State* L, int Key, bool Methods)
+        {
+            if (lua_type(L, Key) != LUA_TSTRING)
+            {
+                return false;
+            }
+            return !Methods || std::strncmp(lua_tostring(L, Key), "__", 2) != 0;
+        }
+
+        // Copies the members of the parent table on top of the stack into the child table below it. Keys the child
+        // defines itself are kept. Keys it got from the parent before still hold what was copied, they are updated
+        // and dropped when the parent lost them. Pops both tables and returns the number of entries added.
+        inline size_t CopyMembers(lua_State* L, int State, bool Methods)
+        {
+            auto Parent = lua_gettop(L);
+            auto Child = Parent - 1;
+            lua_rawgeti(L, State, 2);
+            lua_pushvalue(L, Child);
+            lua_rawget(L, -2);
+            if (lua_isnil(L, -1))
+            {
+                lua_pop(L, 1);
+                lua_newtable(L);
+                lua_pushvalue(L, Child);
+                lua_pushvalue(L, -2);
+                lua_rawset(L, -4);
+            }
+            // Key to the value copied for it
+            auto Inherited = lua_gettop(L);
+
+            // Clearing fields of the table being traversed is allowed
+            for (lua_pushnil(L); lua_next(L, Inherited); lua_pop(L, 1))
+            {
+                lua_pushvalue(L, -2);
+                lua_rawget(L, Child);
+                bool bCopy = lua_rawequal(L, -1, -2) != 0;
+                lua_pop(L, 1);
+                lua_pushvalue(L, -2);
+                lua_rawget(L, Parent);
+                bool bGone = lua_isnil(L, -1);
+                lua_pop(L, 1);
+                if (bCopy && bGone)
+                {
+                    lua_pushvalue(L, -2);
+                    lua_pushnil(L);
+                    lua_rawset(L, Child);
+                }
+                if (!bCopy || bGone)
+                {
+                    lua_pushvalue(L, -2);
+                    lua_pushnil(L);
+                    lua_rawset(L, Inherited);
+                }
+            }
+
+            size_t Added = 0;
+            for (lua_pushnil(L); lua_next(L, Parent); lua_pop(L, 1))
+            {
+                if (!IsMemberKey(L, -2, Methods))
+                {
+                    continue;
+                }
+                lua_pushvalue(L, -2);
+                lua_rawget(L, Child);
+                lua_pushvalue(L, -3);
+                lua_rawget(L, Inherited);
+                bool bEmpty = lua_isnil(L, -2);
+                bool bOwn = !bEmpty && !lua_rawequal(L, -1, -2);
+                lua_pop(L, 2);
+                if (bOwn)
+                {
+                    continue;
+                }
+                lua_pushvalue(L, -2);
+                lua_pushvalue(L, -2);
+                lua_rawset(L, Child);
+                lua_pushvalue(L, -2);
+                lua_pushvalue(L, -2);
+                lua_rawset(L, Inherited);
+                Added += bEmpty ? 1 : 0;
+            }
+            lua_settop(L, Child - 1);
+            return Added;
+        }
+
+        // Copies every recorded pair from the one at First on, in the order they were recorded
+        inline void CopyPairs(lua_State* L, int State, lua_Integer First)
+        {
+            auto Start = std::chrono::steady_clock::now();
+            auto Heap = HeapBytes(L);
+            size_t Added = 0;
+            lua_rawgeti(L, State, 1);
+            auto Pairs = lua_gettop(L);
+            auto Count = static_cast<lua_Integer>(lua_rawlen(L, Pairs));
+            for (lua_Integer i = First; i <= Count; ++i)
+            {
+                lua_rawgeti(L, Pairs, i);
+                lua_rawgeti(L, -1, 1);
+                lua_rawgeti(L, -2, 2);
+                lua_rawgeti(L, -3, 3);
+                bool Methods = lua_toboolean(L, -1) != 0;
+                lua_pop(L, 1);
+                Added += CopyMembers(L, State, Methods);
+                lua_pop(L, 1);
+            }
+            lua_pop(L, 1);
+
+            auto& Metrics = GetFlattenMetrics(L, State);
+            Metrics.Entries += Added;
+            Metrics.Nanoseconds += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - Start).count());
+            auto Grown = HeapBytes(L);
+            // A collection in between can shrink the heap, it then counts as no growth
+            Metrics.Bytes += Grown > Heap ? Grown - Heap : 0;
+        }
+
+        // Records that the table on top of the stack inherits from the one below it, pops both
+        inline void AddPair(lua_State* L, int State, bool Methods)
+        {
+            lua_rawgeti(L, State, 1);
+            lua_createtable(L, 3, 0);
+            lua_pushvalue(L, -3);
+            lua_rawseti(L, -2, 2);
+            lua_pushvalue(L, -4);
+            lua_rawseti(L, -2, 1);
+            lua_pushboolean(L, Methods);
+            lua_rawseti(L, -2, 3);
+            lua_rawseti(L, -2, static_cast<lua_Integer>(lua_rawlen(L, -2)) + 1);
+            lua_pop(L, 3);
+        }
+    }
+
+    /// Copies the methods and properties T inherits from Base into the tables of T. Base has to be flattened
+    /// first so T also gets what Base inherits, parents registering before children gives that order.
+    template <class T, class Base>
+    inline void FlattenClass(lua_State* L)
+    {
+        detail::PushFlattenState(L);
+        auto State = lua_gettop(L);
+        lua_rawgeti(L, State, 1);
+        auto First = static_cast<lua_Integer>(lua_rawlen(L, -1)) + 1;
+        lua_pop(L, 1);
+
+        portal::PushClassTable<T>(L);
+        portal::PushClassTable<Base>(L);
+        detail::AddPair(L, State, true);
+        portal::PushConstTable<T>(L);
+        portal::PushConstTable<Base>(L);
+        detail::AddPair(L, State, true);
+        for (auto Const : { false, true })
+        {
+            portal::PushGetterTable<T>(L, Const);
+            portal::PushGetterTable<Base>(L, Const);
+            detail::AddPair(L, State, false);
+        }
+        portal::PushSetterTable<T>(L);
+        portal::PushSetterTable<Base>(L);
+        detail::AddPair(L, State, false);
+
+        detail::CopyPairs(L, State, First);
+        ++detail::GetFlattenMetrics(L, State).Classes;
+        lua_pop(L, 1);
+    }
+
+    /// Copies every flattened class again, for after members changed in a parent, a delta registration for one
+    inline void RefreshFlattened(lua_State* L)
+    {
+        lua_rawgetp(L, LUA_REGISTRYINDEX, detail::FlattenKey());
+        if (!lua_isnil(L, -1))
+        {
+            detail::CopyPairs(L, lua_gettop(L), 1);
+        }
+        lua_pop(L, 1);
+    }
+
+    inline FlattenMetrics GetFlattenMetrics(lua_State* L)
+    {
+        lua_rawgetp(L, LUA_REGISTRYINDEX, detail::FlattenKey());
+        if (lua_isnil(L, -1))
+        {
+            lua_pop(L, 1);
+            return FlattenMetrics{ 0, 0, 0, 0 };
+        }
+        auto Metrics = detail::GetFlattenMetrics(L, lua_gettop(L));
+        lua_pop(L, 1);
+        return Metrics;
+    }
+}
@@ -0,0 +1,196 @@
+#pragma once
+
+// Lazily registered namespaces. Each top level namespace gets loaders that run on the first read of its global,
+// or on require when the package library is open. Until then the state only holds one closure per loader.
+
+#include "Portal.h"
+
+#include <new>
+
+namespace lab
+{
+    /// Registers part of a namespace into a state, a namespace split over several translation units has several
+    typedef void (*ModuleLoader)(luaportal::LuaState& LOL, lua_State* L);
+
+    namespace detail
+    {
+        // Registry key of the table mapping a namespace name to the array of its loaders that have not run yet
+        inline void* PendingModulesKey()
+        {
+            static char Key;
+            return &Key;
+        }
+
+        inline int RunLoader(lua_State* L)
+        {
+            auto& LOL = *static_cast<luaportal::LuaState*>(lua_touserdata(L, lua_upvalueindex(1)));
+            auto Loader = *static_cast<ModuleLoader*>(lua_touserdata(L, lua_upvalueindex(2)));
+            Loader(LOL, L);
+            return 0;
+        }
+
+        /// Runs and forgets the pending loaders of the name on top of the stack, pops the name
+        inline void LoadPending(lua_State* L)
+        {
+            lua_rawgetp(L, LUA_REGISTRYINDEX, PendingModulesKey());
+            if (lua_isnil(L, -1))
+            {
+                lua_pop(L, 2);
+                return;
+            }
+            lua_pushvalue(L, -2);
+            lua_rawget(L, -2);
+            if (lua_isnil(L, -1))
+            {
+                lua_pop(L, 3);
+                return;
+            }
+            // Forgotten before running, so namespaces whose classes derive from each other load once
+            lua_pushvalue(L, -3);
+            lua_pushnil(L);
+            lua_rawset(L, -4);
+            auto Count = static_cast<lua_Integer>(lua_rawlen(L, -1));
+            for (lua_Integer i = 1; i <= Count; ++i)
+            {
+                lua_rawgeti(L, -1, i);
+                lua_call(L, 0, 0);
+            }
+            lua_pop(L, 3);
+        }
+
+        // __index of the global table: loads the namespace read, then falls back to the previous __index
+        inline int IndexGlobals(lua_State* L)
+        {
+            lua_pushvalue(L, 2);
+            LoadPending(L);
+            lua_pushvalue(L, 2);
+            lua_rawget(L, 1);
+            if (!lua_isnil(L, -1) || lua_isnil(L, lua_upvalueindex(1)))
+            {
+                return 1;
+            }
+            lua_pop(L, 1);
+            if (lua_isfunction(L, lua_upvalueindex(1)))
+            {
+                lua_pushvalue(L, lua_upvalueindex(1));
+                lua_pushvalue(L, 1);
+                lua_pushvalue(L, 2);
+                lua_call(L, 2, 1);
+            }
+            else
+            {
+                lua_pushvalue(L, 2);
+                lua_gettable(L, lua_upvalueindex(1));
+            }
+            return 1;
+        }
+
+        // package.preload entry, the namespace name is the first upvalue
+        inline int RequireNamespace(lua_State* L)
+        {
+            lua_pushvalue(L, lua_upvalueindex(1));
+            LoadPending(L);
+            lua_pushglobaltable(L);
+            lua_pushvalue(L, lua_upvalueindex(1));
+            lua_rawget(L, -2);
+            return 1;
+        }
+
+        inline void PushPendingModules(lua_State* L)
+        {
+            lua_rawgetp(L, LUA_REGISTRYINDEX, PendingModulesKey());
+            if (!lua_isnil(L, -1))
+            {
+                return;
+            }
+            lua_pop(L, 1);
+            lua_newtable(L);
+            lua_pushvalue(L, -1);
+            lua_rawsetp(L, LUA_REGISTRYINDEX, PendingModulesKey());
+
+            lua_pushglobaltable(L);
+            if (!lua_getmetatable(L, -1))
+            {
+                lua_newtable(L);
+                lua_pushvalue(L, -1);
+                lua_setmetatable(L, -3);
+            }
+            lua_pushliteral(L, "__index");
+            lua_pushvalue(L, -1);
+            lua_rawget(L, -3);
+            lua_pushcclosure(L, &IndexGlobals, 1);
+            lua_rawset(L, -3);
+            lua_pop(L, 2);
+        }
+
+        inline void AddPreload(lua_State* L, const char* Name)
+        {
+            lua_pushglobaltable(L);
+            lua_pushliteral(L, "package");
+            lua_rawget(L, -2);
+            if (lua_istable(L, -1))
+            {
+                lua_getfield(L, -1, "preload");
+                if (lua_istable(L, -1))
+                {
+                    lua_pushstring(L, Name);
+                    lua_pushvalue(L, -1);
+                    lua_pushcclosure(L, &RequireNamespace, 1);
+                    lua_rawset(L, -3);
+                }
+                lua_pop(L, 1);
+            }
+            lua_pop(L, 2);
+        }
+    }
+
+    /// Defers Loader until the global Name is first read or required
+    inline void AddModule(luaportal::LuaState& LOL, const char* Name, ModuleLoader Loader)
+    {
+        auto L = portal::GetState(LOL);
+        detail::PushPendingModules(L);
+        lua_pushstring(L, Name);
+        lua_rawget(L, -2);
+        if (lua_isnil(L, -1))
+        {
+            lua_pop(L, 1);
+            lua_newtable(L);
+            lua_pushstring(L, Name);
+            lua_pushvalue(L, -2);
+            lua_rawset(L, -4);
+            detail::AddPreload(L, Name);
+        }
+        lua_pushlightuserdata(L, &LOL);
+        new (lua_newuserdata(L, sizeof(ModuleLoader))) ModuleLoader(Loader);
+        lua_pushcclosure(L, &detail::RunLoader, 2);
+        lua_rawseti(L, -2, static_cast<lua_Integer>(lua_rawlen(L, -2)) + 1);
+        lua_pop(L, 2);
+    }
+
+    /// Runs the loaders of Name now if they have not run, for bindings that need its classes registered first
+    inline void RequireModule(lua_State* L, const char* Name)
+    {
+        lua_pushstring(L, Name);
+        detail::LoadPending(L);
+    }
+
+    /// Runs every loader that has not run, leaving the state as eager registration would
+    inline void LoadModules(lua_State* L)
+    {
+        lua_rawgetp(L, LUA_REGISTRYINDEX, detail::PendingModulesKey());
+        if (lua_isnil(L, -1))
+        {
+            lua_pop(L, 1);
+            return;
+        }
+        // Loading clears the entry, so every round starts from the first key still pending
+        lua_pushnil(L);
+        while (lua_next(L, -2))
+        {
+            lua_pop(L, 1);
+            detail::LoadPending(L);
+            lua_pushnil(L);
+        }
+        lua_pop(L, 1);
+    }
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+// Everything the lab runtime needs from luaportal, so the rest of the runtime only talks to the lua c api.
+// luaportal follows LuaBridge: class tables live in the registry under per type keys and values cross the
+// stack through Stack<T>. If luaportal changes how it stores classes, this is the only file to update. The class,
+// static and property tables are checked as they are pushed, so a luaportal that stores them elsewhere fails the first
+// registration with a lua error instead of handing a nil to the next lookup. The file keeps to the lua 5.1 api, so
+// lab/Ffi.h builds on it against LuaJIT.
+
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+
+#include <type_traits>
+#include <utility>
+
+namespace lab
+{
+    namespace portal
+    {
+        inline lua_State* GetState(luaportal::LuaState& State)
+        {
+            return State.GetState();
+        }
+
+        /// Reads argument Index as T, raising a lua error when it does not convert
+        template <class T>
+        inline T Get(lua_State* L, int Index)
+        {
+            return luaportal::Stack<T>::Get(L, Index);
+        }
+
+        template <class T>
+        inline void Push(lua_State* L, T&& Value)
+        {
+            luaportal::Stack<typename std::decay<T>::type>::Push(L, std::forward<T>(Value));
+        }
+
+        /// The object a method is called on, Const allows a const object
+        template <class T>
+        inline T* GetObject(lua_State* L, int Index, bool Const)
+        {
+            return luaportal::Userdata::Get<T>(L, Index, Const);
+        }
+
+        namespace detail
+        {
+            // Raises a lua error unless the value on top of the stack is a table
+            inline void CheckTable(lua_State* L, const char* What)
+            {
+                if (!lua_istable(L, -1))
+                {
+                    luaL_error(L, "lab: luaportal keeps no %s table where lab/Portal.h looks for it", What);
+                }
+            }
+
+            // lua_rawgetp in the lua 5.1 api, the only one LuaJIT has and so all lab/Ffi.h may use
+            inline void RawGetPointer(lua_State* L, int Table, const void* Key)
+            {
+                lua_pushlightuserdata(L, const_cast<void*>(Key));
+                lua_rawget(L, (Table < 0 && Table > LUA_REGISTRYINDEX) ? Table - 1 : Table);
+            }
+        }
+
+        /// Registry key of the metatable of T objects, or of const T objects when Const is set
+        template <class T>
+        inline const void* GetClassKey(bool Const)
+        {
+            return Const ? luaportal::ClassInfo<T>::GetConstKey() : luaportal::ClassInfo<T>::GetClassKey();
+        }
+
+        /// Pushes the table non const methods of T are looked up in
+        template <class T>
+        inline void PushClassTable(lua_State* L)
+        {
+            detail::RawGetPointer(L, LUA_REGISTRYINDEX, luaportal::ClassInfo<T>::GetClassKey());
+            detail::CheckTable(L, "class");
+        }
+
+        /// Pushes the table const methods of T are looked up in
+        template <class T>
+        inline void PushConstTable(lua_State* L)
+        {
+            detail::RawGetPointer(L, LUA_REGISTRYINDEX, luaportal::ClassInfo<T>::GetConstKey());
+            detail::CheckTable(L, "const class");
+        }
+
+        /// Pushes the table property getters of T are looked up in, for const objects when Const is set
+        template <class T>
+        inline void PushGetterTable(lua_State* L, bool Const)
+        {
+            if (Const)
+            {
+                PushConstTable<T>(L);
+            }
+            else
+            {
+                PushClassTable<T>(L);
+            }
+            detail::RawGetPointer(L, -1, luaportal::GetPropgetKey());
+            detail::CheckTable(L, "property getter");
+            lua_remove(L, -2);
+        }
+
+        /// Pushes the table property setters of T are looked up in
+        template <class T>
+        inline void PushSetterTable(lua_State* L)
+        {
+            PushClassTable<T>(L);
+            detail::RawGetPointer(L, -1, luaportal::GetPropsetKey());
+            detail::CheckTable(L, "property setter");
+            lua_remove(L, -2);
+        }
+
+        /// Pushes the table static members of T are looked up in
+        template <class T>
+        inline void PushStaticTable(lua_State* L)
+        {
+            detail::RawGetPointer(L, LUA_REGISTRYINDEX, luaportal::ClassInfo<T>::GetStaticKey());
+            detail::CheckTable(L, "static class");
+        }
+    }
+}
@@ -0,0 +1,280 @@
+#pragma once
+
+// Per binding call counters, ProfileMode::Calls. Every generated thunk counts its calls into one slot of a flat array
+// its file defines, and times one call in LAB_PROFILE_SAMPLE into the total, longest time and histogram of the slot.
+// Two clock reads cost more than a small thunk, timing a sample keeps the counting within a few percent of it. The
+// arrays link themselves into one process wide list when the binary loads, so every state and thread counts into the
+// same slots, and the counts are exact as long as a binding is not called from two threads at once. Build with LAB_PROFILE=0 to keep the arrays but compile the counting out of every thunk, or with
+// LAB_PROFILE_SAMPLE=1 to time every call.
+
+#include <lua.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#ifndef LAB_PROFILE
+#define LAB_PROFILE 1
+#endif
+
+#ifndef LAB_PROFILE_SAMPLE
+#define LAB_PROFILE_SAMPLE 64
+#endif
+
+// Keeps the clock reads of the sampled calls out of the thunks
+#if defined(__GNUC__) || defined(__clang__)
+#define LAB_PROFILE_COLD __attribute__((noinline, cold))
+#elif defined(_MSC_VER)
+#define LAB_PROFILE_COLD __declspec(noinline)
+#else
+#define LAB_PROFILE_COLD
+#endif
+
+namespace lab
+{
+    /// Bucket i counts calls that took from 2^i up to 2^(i+1) nanoseconds, the last bucket also every longer one
+    const int ProfileBuckets = 32;
+
+    /// One call in ProfileSampleRate is timed, a power of two
+    const uint64_t ProfileSampleRate = LAB_PROFILE_SAMPLE;
+    static_assert(ProfileSampleRate > 0 && (ProfileSampleRate & (ProfileSampleRate - 1)) == 0, "LAB_PROFILE_SAMPLE must be a power of two");
+
+    /// Counters of one binding, zero until the thunk is first called. Calls counts every call, the others only the
+    /// Sampled ones that were timed.
+    struct BindingStats
+    {
+        std::atomic<uint64_t> Calls;
+        std::atomic<uint64_t> Sampled;
+        std::atomic<uint64_t> Nanoseconds;
+        std::atomic<uint64_t> MaxNanoseconds;
+        std::atomic<uint64_t> Histogram[ProfileBuckets];
+    };
+
+    /// The counters of one generated file, Stats[Id] belongs to the binding lua reaches as Names[Id]
+    struct ProfileBlock
+    {
+        const char* const* Names;
+        BindingStats* Stats;
+        size_t Count;
+        ProfileBlock* Next;
+
+        ProfileBlock(const char* const* Names, BindingStats* Stats, size_t Count);
+        // Unlinks the block, for a library unloaded before the process ends
+        ~ProfileBlock();
+    };
+
+    namespace detail
+    {
+        inline ProfileBlock*& FirstProfileBlock()
+        {
+            static ProfileBlock* First = nullptr;
+            return First;
+        }
+
+        inline int GetBucket(uint64_t Nanoseconds)
+        {
+            if (Nanoseconds == 0)
+            {
+                return 0;
+            }
+#if defined(__GNUC__) || defined(__clang__)
+            int Bucket = 63 - __builtin_clzll(Nanoseconds);
+#else
+            int Bucket = 0;
+            while (Nanoseconds >>= 1)
+            {
+                ++Bucket;
+            }
+#endif
+            return Bucket < ProfileBuckets ? Bucket : ProfileBuckets - 1;
+        }
+
+        // Counts a call, true when it is the one of its sample to time. A load and a store instead of a locked add,
+        // which alone costs a quarter of a small thunk: threads calling the same binding at once may lose a count.
+        inline bool Count(BindingStats& Stats)
+        {
+            auto Calls = Stats.Calls.load(std::memory_order_relaxed);
+            Stats.Calls.store(Calls + 1, std::memory_order_relaxed);
+            return (Calls & (ProfileSampleRate - 1)) == 0;
+        }
+
+        inline void Record(BindingStats& Stats, uint64_t Nanoseconds)
+        {
+            Stats.Sampled.fetch_add(1, std::memory_order_relaxed);
+            Stats.Nanoseconds.fetch_add(Nanoseconds, std::memory_order_relaxed);
+            auto Max = Stats.MaxNanoseconds.load(std::memory_order_relaxed);
+            while (Nanoseconds > Max && !Stats.MaxNanoseconds.compare_exchange_weak(Max, Nanoseconds, std::memory_order_relaxed))
+            {
+            }
+            Stats.Histogram[GetBucket(Nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    inline ProfileBlock::ProfileBlock(const char* const* Names, BindingStats* Stats, size_t Count)
+        : Names(Names)
+        , Stats(Stats)
+        , Count(Count)
+        , Next(detail::FirstProfileBlock())
+    {
+        detail::FirstProfileBlock() = this;
+    }
+
+    inline ProfileBlock::~ProfileBlock()
+    {
+        for (auto Link = &detail::FirstProfileBlock(); *Link; Link = &(*Link)->Next)
+        {
+            if (*Link == this)
+            {
+                *Link = Next;
+                break;
+            }
+        }
+    }
+
+    namespace detail
+    {
+        LAB_PROFILE_COLD inline int64_t StartSample()
+        {
+            return std::chrono::steady_clock::now().time_since_epoch().count();
+        }
+
+        LAB_PROFILE_COLD inline void EndSample(BindingStats& Stats, int64_t Start)
+        {
+            auto Elapsed = std::chrono::steady_clock::now().time_since_epoch().count() - Start;
+            Record(Stats, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::duration(Elapsed)).count()));
+        }
+    }
+
+    /// Counts one call into Stats and, for the calls it samples, records its time when it goes out of scope. A lua
+    /// error raised by longjmp skips the destructor, so a sampled call that fails an argument check is counted but
+    /// not timed unless lua is built as C++.
+    class ProfileScope
+    {
+    public:
+        explicit ProfileScope(BindingStats& Stats)
+            : Stats(Stats)
+            , Start(detail::Count(Stats) ? detail::StartSample() : 0)
+        {
+        }
+
+        ~ProfileScope()
+        {
+            if (Start != 0)
+            {
+                detail::EndSample(Stats, Start);
+            }
+        }
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+
+    private:
+        BindingStats& Stats;
+        // Clock ticks when the call started, 0 when it is not sampled
+        int64_t Start;
+    };
+
+    /// Calls Visit(Name, Stats) for every binding of every generated file loaded into the process
+    template <class Fn>
+    inline void ForEachBinding(Fn&& Visit)
+    {
+        for (auto Block = detail::FirstProfileBlock(); Block; Block = Block->Next)
+        {
+            for (size_t i = 0; i < Block->Count; ++i)
+            {
+                Visit(Block->Names[i], static_cast<const BindingStats&>(Block->Stats[i]));
+            }
+        }
+    }
+
+    /// Sets every counter back to zero. Calls running meanwhile may be counted before or after the reset.
+    inline void ResetBindingStats()
+    {
+        for (auto Block = detail::FirstProfileBlock(); Block; Block = Block->Next)
+        {
+            for (size_t i = 0; i < Block->Count; ++i)
+            {
+                auto& Stats = Block->Stats[i];
+                Stats.Calls.store(0, std::memory_order_relaxed);
+                Stats.Sampled.store(0, std::memory_order_relaxed);
+                Stats.Nanoseconds.store(0, std::memory_order_relaxed);
+                Stats.MaxNanoseconds.store(0, std::memory_order_relaxed);
+                for (auto& Bucket : Stats.Histogram)
+                {
+                    Bucket.store(0, std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+
+    namespace detail
+    {
+        inline void SetInteger(lua_State* L, const char* Name, uint64_t Value)
+        {
+            lua_pushinteger(L, static_cast<lua_Integer>(Value));
+            lua_setfield(L, -2, Name);
+        }
+
+        // __bindingstats([reset]): name to { calls, sampled, nanoseconds, max, histogram } for every binding called so
+        // far. nanoseconds, max and the histogram cover the sampled calls, the histogram ends at its last used bucket.
+        // Passing true also sets every counter back to zero.
+        inline int PushBindingStats(lua_State* L)
+        {
+            bool bReset = lua_toboolean(L, 1) != 0;
+            lua_newtable(L);
+            for (auto Block = FirstProfileBlock(); Block; Block = Block->Next)
+            {
+                for (size_t i = 0; i < Block->Count; ++i)
+                {
+                    auto& Stats = Block->Stats[i];
+                    if (Stats.Calls.load(std::memory_order_relaxed) == 0)
+                    {
+                        continue;
+                    }
+                    lua_createtable(L, 0, 5);
+                    SetInteger(L, "calls", Stats.Calls.load(std::memory_order_relaxed));
+                    SetInteger(L, "sampled", Stats.Sampled.load(std::memory_order_relaxed));
+                    SetInteger(L, "nanoseconds", Stats.Nanoseconds.load(std::memory_order_relaxed));
+                    SetInteger(L, "max", Stats.MaxNanoseconds.load(std::memory_order_relaxed));
+                    int Used = ProfileBuckets;
+                    while (Used > 0 && Stats.Histogram[Used - 1].load(std::memory_order_relaxed) == 0)
+                    {
+                        --Used;
+                    }
+                    lua_createtable(L, Used, 0);
+                    for (int Bucket = 0; Bucket < Used; ++Bucket)
+                    {
+                        lua_pushinteger(L, static_cast<lua_Integer>(Stats.Histogram[Bucket].load(std::memory_order_relaxed)));
+                        lua_rawseti(L, -2, Bucket + 1);
+                    }
+                    lua_setfield(L, -2, "histogram");
+                    lua_setfield(L, -2, Block->Names[i]);
+                }
+            }
+            if (bReset)
+            {
+                ResetBindingStats();
+            }
+            return 1;
+        }
+    }
+
+    /// Sets the global __bindingstats of the state, unless the counting is compiled out
+    inline void BindProfile(lua_State* L)
+    {
+#if LAB_PROFILE
+        lua_pushcfunction(L, &detail::PushBindingStats);
+        lua_setglobal(L, "__bindingstats");
+#else
+        (void)L;
+#endif
+    }
+}
+
+// The first statement of every generated thunk when profiling
+#if LAB_PROFILE
+#define LAB_PROFILE_CALL(Stats) lab::ProfileScope LabProfileScope(Stats)
+#else
+#define LAB_PROFILE_CALL(Stats) ((void)0)
+#endif
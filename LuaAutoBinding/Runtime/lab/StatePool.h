@@ -0,0 +1,391 @@
+#pragma once
+
+// A fixed set of registered states handed out per request. Registration runs once per state when the pool is
+// built, releasing a state puts its globals and every table reachable from them back to how registration left them
+// instead of building it again.
+
+#include "Module.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace lab
+{
+    class StatePool
+    {
+    public:
+        /// Registers the bindings of a new state, usually the generated RegisterAPIs
+        typedef std::function<void(luaportal::LuaState&)> RegisterFunction;
+
+        struct Metrics
+        {
+            size_t Size;
+            size_t InUse;
+            // Most states out at the same time since the pool was built
+            size_t HighWater;
+            uint64_t Acquires;
+            // Acquires that found no free state and waited for one
+            uint64_t Waits;
+            uint64_t WaitNanoseconds;
+            uint64_t MaxWaitNanoseconds;
+        };
+
+        /// A state taken from the pool, given back when the lease is destroyed or released
+        class Lease
+        {
+        public:
+            Lease() = default;
+
+            Lease(Lease&& Other)
+                : Pool(Other.Pool), Slot(Other.Slot)
+            {
+                Other.Pool = nullptr;
+            }
+
+            Lease& operator=(Lease&& Other)
+            {
+                if (this != &Other)
+                {
+                    Release();
+                    Pool = Other.Pool;
+                    Slot = Other.Slot;
+                    Other.Pool = nullptr;
+                }
+                return *this;
+            }
+
+            Lease(const Lease&) = delete;
+            Lease& operator=(const Lease&) = delete;
+
+            ~Lease()
+            {
+                Release();
+            }
+
+            explicit operator bool() const
+            {
+                return Pool != nullptr;
+            }
+
+            luaportal::LuaState& operator*() const
+            {
+                return *Pool->Slots[Slot]->State;
+            }
+
+            luaportal::LuaState* operator->() const
+            {
+                return Pool->Slots[Slot]->State.get();
+            }
+
+            void Release()
+            {
+                if (Pool)
+                {
+                    Pool->Release(Slot);
+                    Pool = nullptr;
+                }
+            }
+
+        private:
+            friend class StatePool;
+
+            Lease(StatePool* InPool, uint32_t InSlot)
+                : Pool(InPool), Slot(InSlot)
+            {
+            }
+
+            StatePool* Pool = nullptr;
+            uint32_t Slot = 0;
+        };
+
+        /// Creates and registers Count states. Lazy namespaces are loaded here, so a released state is complete.
+        StatePool(size_t Count, RegisterFunction Register)
+        {
+            Slots.reserve(Count);
+            for (size_t i = 0; i < Count; ++i)
+            {
+                std::unique_ptr<Slot> Item(new Slot);
+                Item->State.reset(new luaportal::LuaState());
+                Register(*Item->State);
+                auto L = portal::GetState(*Item->State);
+                LoadModules(L);
+                SaveBaseline(L);
+                Slots.push_back(std::move(Item));
+            }
+            for (size_t i = Count; i-- > 0;)
+            {
+                Push(static_cast<uint32_t>(i));
+            }
+        }
+
+        StatePool(const StatePool&) = delete;
+        StatePool& operator=(const StatePool&) = delete;
+
+        /// Takes a free state without locking, waits for a release when every state is out
+        Lease Acquire()
+        {
+            uint32_t Index;
+            if (!Pop(Index))
+            {
+                auto Start = std::chrono::steady_clock::now();
+                {
+                    std::unique_lock<std::mutex> Lock(Mutex);
+                    ++Waiting;
+                    Released.wait(Lock, [&]() { return Pop(Index); });
+                    --Waiting;
+                }
+                auto Wait = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - Start).count());
+                ++Waits;
+                WaitNanoseconds += Wait;
+                UpdateMax(MaxWaitNanoseconds, Wait);
+            }
+            OnAcquire();
+            return Lease(this, Index);
+        }
+
+        /// Takes a free state, or returns an empty lease when every state is out
+        Lease TryAcquire()
+        {
+            uint32_t Index;
+            if (!Pop(Index))
+            {
+                return Lease();
+            }
+            OnAcquire();
+            return Lease(this, Index);
+        }
+
+        Metrics GetMetrics() const
+        {
+            return Metrics{ Slots.size(), InUse.load(), HighWater.load(), Acquires.load(), Waits.load(), WaitNanoseconds.load(), MaxWaitNanoseconds.load() };
+        }
+
+    private:
+        struct Slot
+        {
+            std::unique_ptr<luaportal::LuaState> State;
+            // Index + 1 of the next free slot, 0 ends the list
+            std::atomic<uint32_t> Next{ 0 };
+        };
+
+        // Registry key of the baseline: every table reachable from the globals after registration, namespace and
+        // class tables and their metatables included, mapped to a copy of its fields
+        static void* BaselineKey()
+        {
+            static char Key;
+            return &Key;
+        }
+
+        // Key of the metatable of a table inside its copy, a script cannot set it on the table itself
+        static void* MetatableKey()
+        {
+            static char Key;
+            return &Key;
+        }
+
+        static void Enqueue(lua_State* L, int Index, int Pending, lua_Integer& Count)
+        {
+            if (lua_type(L, Index) == LUA_TTABLE || lua_type(L, Index) == LUA_TUSERDATA)
+            {
+                lua_pushvalue(L, Index);
+                lua_rawseti(L, Pending, ++Count);
+            }
+        }
+
+        static void SaveBaseline(lua_State* L)
+        {
+            lua_newtable(L);
+            auto Baseline = lua_gettop(L);
+            lua_newtable(L);
+            auto Pending = lua_gettop(L);
+            lua_Integer Count = 0;
+            lua_pushglobaltable(L);
+            lua_rawseti(L, Pending, ++Count);
+            while (Count > 0)
+            {
+                lua_rawgeti(L, Pending, Count);
+                lua_pushnil(L);
+                lua_rawseti(L, Pending, Count--);
+                auto Table = lua_gettop(L);
+                if (!lua_istable(L, Table))
+                {
+                    // Of a userdata only the metatable can hold bindings
+                    if (lua_getmetatable(L, Table))
+                    {
+                        lua_rawseti(L, Pending, ++Count);
+                    }
+                    lua_pop(L, 1);
+                    continue;
+                }
+                lua_pushvalue(L, Table);
+                if (lua_rawget(L, Baseline) != LUA_TNIL)
+                {
+                    lua_pop(L, 2);
+                    continue;
+                }
+                lua_pop(L, 1);
+                // Weak tables are caches, they are neither copied nor walked
+                if (luaL_getmetafield(L, Table, "__mode") != LUA_TNIL)
+                {
+                    lua_pop(L, 1);
+                    lua_pushboolean(L, 0);
+                    lua_rawset(L, Baseline);
+                    continue;
+                }
+                lua_newtable(L);
+                auto Copy = lua_gettop(L);
+                for (lua_pushnil(L); lua_next(L, Table); )
+                {
+                    Enqueue(L, -2, Pending, Count);
+                    Enqueue(L, -1, Pending, Count);
+                    lua_pushvalue(L, -2);
+                    lua_insert(L, -2);
+                    lua_rawset(L, Copy);
+                }
+                if (lua_getmetatable(L, Table))
+                {
+                    Enqueue(L, -1, Pending, Count);
+                    lua_rawsetp(L, Copy, MetatableKey());
+                }
+                lua_rawset(L, Baseline);
+            }
+            lua_pop(L, 1);
+            lua_rawsetp(L, LUA_REGISTRYINDEX, BaselineKey());
+        }
+
+        // Clears fields a script added to Table, puts back the ones it replaced or removed and resets its metatable
+        static void RestoreTable(lua_State* L, int Table, int Copy)
+        {
+            // Only existing fields are cleared or assigned while the table is traversed
+            for (lua_pushnil(L); lua_next(L, Table); lua_pop(L, 1))
+            {
+                lua_pushvalue(L, -2);
+                lua_rawget(L, Copy);
+                if (!lua_rawequal(L, -1, -2))
+                {
+                    lua_pushvalue(L, -3);
+                    lua_insert(L, -2);
+                    lua_rawset(L, Table);
+                }
+                else
+                {
+                    lua_pop(L, 1);
+                }
+            }
+            for (lua_pushnil(L); lua_next(L, Copy); lua_pop(L, 1))
+            {
+                if (lua_touserdata(L, -2) == MetatableKey())
+                {
+                    continue;
+                }
+                lua_pushvalue(L, -2);
+                lua_rawget(L, Table);
+                if (lua_isnil(L, -1))
+                {
+                    lua_pushvalue(L, -3);
+                    lua_pushvalue(L, -3);
+                    lua_rawset(L, Table);
+                }
+                lua_pop(L, 1);
+            }
+            lua_rawgetp(L, Copy, MetatableKey());
+            lua_setmetatable(L, Table);
+        }
+
+        // Puts every table of the baseline back, so a script that set a global, a namespace or class field or a
+        // method in a metatable leaves nothing behind. Costs a pass over every field of every baseline table.
+        static void RestoreBaseline(lua_State* L)
+        {
+            lua_settop(L, 0);
+            lua_rawgetp(L, LUA_REGISTRYINDEX, BaselineKey());
+            for (lua_pushnil(L); lua_next(L, 1); lua_pop(L, 1))
+            {
+                if (lua_istable(L, -1))
+                {
+                    RestoreTable(L, 2, 3);
+                }
+            }
+            lua_settop(L, 0);
+        }
+
+        void Release(uint32_t Index)
+        {
+            RestoreBaseline(portal::GetState(*Slots[Index]->State));
+            --InUse;
+            Push(Index);
+            if (Waiting.load() > 0)
+            {
+                std::lock_guard<std::mutex> Lock(Mutex);
+                Released.notify_one();
+            }
+        }
+
+        void OnAcquire()
+        {
+            ++Acquires;
+            UpdateMax(HighWater, ++InUse);
+        }
+
+        template <class T>
+        static void UpdateMax(std::atomic<T>& Max, T Value)
+        {
+            auto Current = Max.load();
+            while (Current < Value && !Max.compare_exchange_weak(Current, Value))
+            {
+            }
+        }
+
+        // The free list is a stack of slot indices. The head keeps a tag in its high half that changes on
+        // every push and pop, so a pop that read a head which was popped and pushed again in between fails.
+        static uint64_t MakeHead(uint32_t Index, uint32_t Tag)
+        {
+            return (static_cast<uint64_t>(Tag) << 32) | Index;
+        }
+
+        bool Pop(uint32_t& Index)
+        {
+            auto Head = Free.load();
+            while (static_cast<uint32_t>(Head) != 0)
+            {
+                auto Top = static_cast<uint32_t>(Head) - 1;
+                auto Next = Slots[Top]->Next.load(std::memory_order_relaxed);
+                if (Free.compare_exchange_weak(Head, MakeHead(Next, static_cast<uint32_t>(Head >> 32) + 1)))
+                {
+                    Index = Top;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void Push(uint32_t Index)
+        {
+            auto Head = Free.load();
+            do
+            {
+                Slots[Index]->Next.store(static_cast<uint32_t>(Head), std::memory_order_relaxed);
+            } while (!Free.compare_exchange_weak(Head, MakeHead(Index + 1, static_cast<uint32_t>(Head >> 32) + 1)));
+        }
+
+        std::vector<std::unique_ptr<Slot>> Slots;
+        std::atomic<uint64_t> Free{ 0 };
+
+        // Only taken when no state is free
+        std::mutex Mutex;
+        std::condition_variable Released;
+        std::atomic<size_t> Waiting{ 0 };
+
+        std::atomic<size_t> InUse{ 0 };
+        std::atomic<size_t> HighWater{ 0 };
+        std::atomic<uint64_t> Acquires{ 0 };
+        std::atomic<uint64_t> Waits{ 0 };
+        std::atomic<uint64_t> WaitNanoseconds{ 0 };
+        std::atomic<uint64_t> MaxWaitNanoseconds{ 0 };
+    };
+}
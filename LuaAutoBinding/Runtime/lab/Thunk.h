@@ -0,0 +1,185 @@
+#pragma once
+
+// Shared call thunks. There is one lua_CFunction per function type rather than one per bound function,
+// the function it calls travels as the first upvalue of the closure.
+
+#include "Portal.h"
+
+#include <cstring>
+#include <new>
+#include <utility>
+
+namespace lab
+{
+    namespace detail
+    {
+        template <class R>
+        struct Invoker
+        {
+            template <class F, class... Args>
+            static int Call(lua_State* L, F&& Function, Args&&... Arguments)
+            {
+                portal::Push(L, Function(std::forward<Args>(Arguments)...));
+                return 1;
+            }
+        };
+
+        template <>
+        struct Invoker<void>
+        {
+            template <class F, class... Args>
+            static int Call(lua_State* L, F&& Function, Args&&... Arguments)
+            {
+                Function(std::forward<Args>(Arguments)...);
+                return 0;
+            }
+        };
+
+        /// The bound function of the running closure
+        template <class Fn>
+        inline Fn& Target(lua_State* L)
+        {
+            return *static_cast<Fn*>(lua_touserdata(L, lua_upvalueindex(1)));
+        }
+
+        /// Pushes Thunk as a closure over a copy of Function
+        template <class Thunk, class Fn>
+        inline void PushClosure(lua_State* L, Fn Function)
+        {
+            new (lua_newuserdata(L, sizeof(Fn))) Fn(Function);
+            lua_pushcclosure(L, &Thunk::Call, 1);
+        }
+
+        /// Sets Table[Name] to the closure on top of the stack and pops it
+        inline void SetField(lua_State* L, int Table, const char* Name)
+        {
+            Table = lua_absindex(L, Table);
+            lua_pushstring(L, Name);
+            lua_insert(L, -2);
+            lua_rawset(L, Table);
+        }
+    }
+
+    template <class Fn>
+    struct FunctionThunk;
+
+    template <class R, class... A>
+    struct FunctionThunk<R (*)(A...)>
+    {
+        static int Call(lua_State* L)
+        {
+            return Apply(L, std::index_sequence_for<A...>());
+        }
+
+        template <size_t... I>
+        static int Apply(lua_State* L, std::index_sequence<I...>)
+        {
+            auto Function = detail::Target<R (*)(A...)>(L);
+            return detail::Invoker<R>::Call(L, Function, portal::Get<A>(L, static_cast<int>(I) + 1)...);
+        }
+    };
+
+    template <class Fn>
+    struct MemberThunk;
+
+    template <class T, class R, class... A>
+    struct MemberThunk<R (T::*)(A...)>
+    {
+        static const bool IsConst = false;
+
+        static int Call(lua_State* L)
+        {
+            return Apply(L, std::index_sequence_for<A...>());
+        }
+
+        template <size_t... I>
+        static int Apply(lua_State* L, std::index_sequence<I...>)
+        {
+            auto Method = detail::Target<R (T::*)(A...)>(L);
+            T* Self = portal::GetObject<T>(L, 1, false);
+            return detail::Invoker<R>::Call(L, [Self, Method](A... Arguments) -> R {
+                return (Self->*Method)(std::forward<A>(Arguments)...);
+            }, portal::Get<A>(L, static_cast<int>(I) + 2)...);
+        }
+    };
+
+    template <class T, class R, class... A>
+    struct MemberThunk<R (T::*)(A...) const>
+    {
+        static const bool IsConst = true;
+
+        static int Call(lua_State* L)
+        {
+            return Apply(L, std::index_sequence_for<A...>());
+        }
+
+        template <size_t... I>
+        static int Apply(lua_State* L, std::index_sequence<I...>)
+        {
+            auto Method = detail::Target<R (T::*)(A...) const>(L);
+            const T* Self = portal::GetObject<T>(L, 1, true);
+            return detail::Invoker<R>::Call(L, [Self, Method](A... Arguments) -> R {
+                return (Self->*Method)(std::forward<A>(Arguments)...);
+            }, portal::Get<A>(L, static_cast<int>(I) + 2)...);
+        }
+    };
+
+    /// Binds a method of T, const methods are also reachable from const objects
+    template <class T, class Fn>
+    inline void BindMethod(lua_State* L, const char* Name, Fn Method)
+    {
+        typedef MemberThunk<Fn> Thunk;
+        portal::PushClassTable<T>(L);
+        detail::PushClosure<Thunk>(L, Method);
+        detail::SetField(L, -2, Name);
+        lua_pop(L, 1);
+        if (Thunk::IsConst)
+        {
+            portal::PushConstTable<T>(L);
+            detail::PushClosure<Thunk>(L, Method);
+            detail::SetField(L, -2, Name);
+            lua_pop(L, 1);
+        }
+    }
+
+    /// Binds a static function of T
+    template <class T, class Fn>
+    inline void BindStatic(lua_State* L, const char* Name, Fn Function)
+    {
+        portal::PushStaticTable<T>(L);
+        detail::PushClosure<FunctionThunk<Fn>>(L, Function);
+        detail::SetField(L, -2, Name);
+        lua_pop(L, 1);
+    }
+
+    /// Pushes the namespace table at a dotted Path of export names, the global table for an empty Path. Raises a lua
+    /// error when a segment of Path is not a table, as when the namespace was never registered.
+    inline void PushNamespace(lua_State* L, const char* Path)
+    {
+        auto FullPath = Path;
+        lua_pushglobaltable(L);
+        while (*Path)
+        {
+            auto End = std::strchr(Path, '.');
+            auto Length = End ? static_cast<size_t>(End - Path) : std::strlen(Path);
+            lua_pushlstring(L, Path, Length);
+            lua_rawget(L, -2);
+            lua_remove(L, -2);
+            if (!lua_istable(L, -1))
+            {
+                luaL_error(L, "lab: namespace %s is not a table at %s", FullPath, lua_pushlstring(L, Path, Length));
+            }
+            Path += End ? Length + 1 : Length;
+        }
+    }
+
+    /// Binds a free or global function into the namespace at Path
+    template <class Fn>
+    inline void BindFunction(lua_State* L, const char* Path, const char* Name, Fn Function)
+    {
+        PushNamespace(L, Path);
+        detail::PushClosure<FunctionThunk<Fn>>(L, Function);
+        detail::SetField(L, -2, Name);
+        lua_pop(L, 1);
+    }
+}
@@ -0,0 +1,297 @@
+#pragma once
+
+// Value classes, LUA_CLASS(value). The object itself is the userdata block instead of a pointer to a heap object,
+// and every push copies it. lab binds the members of a value class through generated thunks, luaportal never sees
+// the class.
+
+#include "Direct.h"
+
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace lab
+{
+    /// Members of a value class as lab generates them, arrays are null terminated or null when empty
+    struct ValueClass
+    {
+        const char* Name;
+        const luaL_Reg* Methods;
+        const luaL_Reg* Getters;
+        const luaL_Reg* Setters;
+        const luaL_Reg* Statics;
+        // Data members in declaration order, shown by __tostring
+        const char* const* Fields;
+        // Called with the class table and the constructor arguments, null to construct T()
+        lua_CFunction Construct;
+    };
+
+    namespace detail
+    {
+        // Registry key of the metatable of T
+        template <class T>
+        inline void* ValueKey()
+        {
+            static char Key;
+            return &Key;
+        }
+
+        template <class T>
+        inline auto Equal(const T& A, const T& B, int) -> decltype(static_cast<bool>(A == B))
+        {
+            return static_cast<bool>(A == B);
+        }
+
+        // Without operator== two values are equal when their bytes are. Only sound when equal values have equal bytes:
+        // no padding, and no float where -0.0 equals 0.0 and NaN does not equal itself.
+        template <class T>
+        inline bool Equal(const T& A, const T& B, long)
+        {
+            return std::memcmp(&A, &B, sizeof(T)) == 0;
+        }
+
+        template <class T>
+        inline auto HasEqualOperator(int) -> decltype(static_cast<bool>(std::declval<const T&>() == std::declval<const T&>()), std::true_type());
+
+        template <class T>
+        inline std::false_type HasEqualOperator(long);
+
+        // True when T has operator== or memcmp compares it soundly
+        template <class T>
+        struct CanCompare
+#ifdef __cpp_lib_has_unique_object_representations
+            : std::integral_constant<bool, decltype(HasEqualOperator<T>(0))::value || std::has_unique_object_representations<T>::value>
+#else
+            : decltype(HasEqualOperator<T>(0))
+#endif
+        {
+        };
+
+        /// The T at Index, or null when Index is not a T
+        template <class T>
+        inline T* TestValue(lua_State* L, int Index)
+        {
+            auto Block = lua_touserdata(L, Index);
+            if (!Block || !lua_getmetatable(L, Index))
+            {
+                return nullptr;
+            }
+            lua_rawgetp(L, LUA_REGISTRYINDEX, ValueKey<T>());
+            bool bMatch = lua_rawequal(L, -1, -2) != 0;
+            lua_pop(L, 2);
+            return bMatch ? static_cast<T*>(Block) : nullptr;
+        }
+
+        template <class T>
+        inline int EqualValues(lua_State* L)
+        {
+            auto A = TestValue<T>(L, 1);
+            auto B = TestValue<T>(L, 2);
+            lua_pushboolean(L, A && B && Equal(*A, *B, 0));
+            return 1;
+        }
+
+        // __eq of T, null to leave it unbound so values only equal themselves
+        template <class T>
+        inline lua_CFunction EqualFunction(std::true_type)
+        {
+            return &EqualValues<T>;
+        }
+
+        template <class T>
+        inline lua_CFunction EqualFunction(std::false_type)
+        {
+            return nullptr;
+        }
+
+        // __index: methods are upvalue 1, getters upvalue 2
+        inline int IndexValue(lua_State* L)
+        {
+            lua_pushvalue(L, 2);
+            if (lua_rawget(L, lua_upvalueindex(1)) != LUA_TNIL)
+            {
+                return 1;
+            }
+            lua_pushvalue(L, 2);
+            if (lua_rawget(L, lua_upvalueindex(2)) == LUA_TNIL)
+            {
+                return 1;
+            }
+            lua_pushvalue(L, 1);
+            lua_call(L, 1, 1);
+            return 1;
+        }
+
+        // __newindex: setters are upvalue 1, the class name upvalue 2
+        inline int NewIndexValue(lua_State* L)
+        {
+            lua_pushvalue(L, 2);
+            if (lua_rawget(L, lua_upvalueindex(1)) == LUA_TNIL)
+            {
+                return luaL_error(L, "%s has no writable member %s", lua_tostring(L, lua_upvalueindex(2)), luaL_tolstring(L, 2, nullptr));
+            }
+            lua_pushvalue(L, 1);
+            lua_pushvalue(L, 3);
+            lua_call(L, 2, 0);
+            return 0;
+        }
+
+        // __tostring: "Name(Field=Value, ...)", the class is upvalue 1 and the getters upvalue 2
+        inline int ValueToString(lua_State* L)
+        {
+            auto& Class = *static_cast<const ValueClass*>(lua_touserdata(L, lua_upvalueindex(1)));
+            luaL_Buffer Buffer;
+            luaL_buffinit(L, &Buffer);
+            luaL_addstring(&Buffer, Class.Name);
+            luaL_addchar(&Buffer, '(');
+            for (auto Field = Class.Fields; Field && *Field; ++Field)
+            {
+                if (Field != Class.Fields)
+                {
+                    luaL_addstring(&Buffer, ", ");
+                }
+                luaL_addstring(&Buffer, *Field);
+                luaL_addchar(&Buffer, '=');
+                lua_getfield(L, lua_upvalueindex(2), *Field);
+                lua_pushvalue(L, 1);
+                lua_call(L, 1, 1);
+                luaL_tolstring(L, -1, nullptr);
+                lua_remove(L, -2);
+                luaL_addvalue(&Buffer);
+            }
+            luaL_addchar(&Buffer, ')');
+            luaL_pushresult(&Buffer);
+            return 1;
+        }
+
+        // Created at the size of the array, filled without growing
+        inline void NewFunctionTable(lua_State* L, const luaL_Reg* Functions)
+        {
+            int Count = 0;
+            for (auto Function = Functions; Function && Function->name; ++Function)
+            {
+                ++Count;
+            }
+            lua_createtable(L, 0, Count);
+            if (Functions)
+            {
+                luaL_setfuncs(L, Functions, 0);
+            }
+        }
+    }
+
+    /// Pushes a copy of Value
+    template <class T>
+    inline void PushValue(lua_State* L, const T& Value)
+    {
+        new (lua_newuserdata(L, sizeof(T))) T(Value);
+        lua_rawgetp(L, LUA_REGISTRYINDEX, detail::ValueKey<T>());
+        lua_setmetatable(L, -2);
+    }
+
+    /// Pushes a copy of the value Value points to, nil for null
+    template <class T>
+    inline void PushValue(lua_State* L, const T* Value)
+    {
+        if (Value)
+        {
+            PushValue(L, *Value);
+        }
+        else
+        {
+            lua_pushnil(L);
+        }
+    }
+
+    /// The T stored in the userdata at Index, raising a lua error for anything else. Writes through the pointer
+    /// change the lua value.
+    template <class T>
+    inline T* ToValue(lua_State* L, int Index)
+    {
+        auto Value = detail::TestValue<T>(L, Index);
+        if (!Value)
+        {
+            lua_rawgetp(L, LUA_REGISTRYINDEX, detail::ValueKey<T>());
+            lua_getfield(L, -1, "__name");
+            luaL_argerror(L, Index, lua_pushfstring(L, "%s expected", lua_tostring(L, -1)));
+        }
+        return Value;
+    }
+
+    namespace detail
+    {
+        template <class T>
+        inline int ConstructDefault(lua_State* L)
+        {
+            lab::PushValue(L, T());
+            return 1;
+        }
+
+        template <class T>
+        inline lua_CFunction DefaultConstructor(std::true_type)
+        {
+            return &ConstructDefault<T>;
+        }
+
+        template <class T>
+        inline lua_CFunction DefaultConstructor(std::false_type)
+        {
+            return nullptr;
+        }
+    }
+
+    /// Fills the metatable of T and puts its class table, holding the statics and called to construct, at Path.
+    /// Binding T again, as a delta registration does, refills the same metatable so values pushed before keep working.
+    template <class T>
+    inline void BindValue(lua_State* L, const char* Path, const ValueClass& Class)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "LUA_CLASS(value) needs a trivially copyable class");
+        static_assert(alignof(T) <= alignof(lua_Number) || alignof(T) <= alignof(void*), "lua does not align userdata for this class");
+
+        lua_rawgetp(L, LUA_REGISTRYINDEX, detail::ValueKey<T>());
+        if (lua_isnil(L, -1))
+        {
+            lua_pop(L, 1);
+            lua_createtable(L, 0, 5);
+            lua_pushvalue(L, -1);
+            lua_rawsetp(L, LUA_REGISTRYINDEX, detail::ValueKey<T>());
+        }
+        lua_pushstring(L, Class.Name);
+        lua_setfield(L, -2, "__name");
+        detail::NewFunctionTable(L, Class.Methods);
+        detail::NewFunctionTable(L, Class.Getters);
+        lua_pushvalue(L, -2);
+        lua_pushvalue(L, -2);
+        lua_pushcclosure(L, &detail::IndexValue, 2);
+        lua_setfield(L, -4, "__index");
+        lua_pushlightuserdata(L, const_cast<ValueClass*>(&Class));
+        lua_insert(L, -2);
+        lua_pushcclosure(L, &detail::ValueToString, 2);
+        lua_setfield(L, -3, "__tostring");
+        lua_pop(L, 1);
+        detail::NewFunctionTable(L, Class.Setters);
+        lua_pushstring(L, Class.Name);
+        lua_pushcclosure(L, &detail::NewIndexValue, 2);
+        lua_setfield(L, -2, "__newindex");
+        if (auto Equal = detail::EqualFunction<T>(detail::CanCompare<T>()))
+        {
+            lua_pushcfunction(L, Equal);
+            lua_setfield(L, -2, "__eq");
+        }
+        lua_pop(L, 1);
+
+        PushNamespace(L, Path);
+        detail::NewFunctionTable(L, Class.Statics);
+        auto Construct = Class.Construct ? Class.Construct : detail::DefaultConstructor<T>(std::is_default_constructible<T>());
+        if (Construct)
+        {
+            lua_createtable(L, 0, 1);
+            lua_pushcfunction(L, Construct);
+            lua_setfield(L, -2, "__call");
+            lua_setmetatable(L, -2);
+        }
+        detail::SetField(L, -2, Class.Name);
+        lua_pop(L, 1);
+    }
+}
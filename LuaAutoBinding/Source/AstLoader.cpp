@@ -0,0 +1,1134 @@
+#include "AstLoader.h"
+#include "Stats.h"
+
+#include <sstream>
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+#include <memory>
+#include <cstdio>
+
+#include <rapidjson/rapidjson.h>
+#include <rapidjson/document.h>
+#include <rapidjson/reader.h>
+#include <rapidjson/filereadstream.h>
+#include <rapidjson/error/en.h>
+
+using namespace rapidjson;
+
+namespace lab
+{
+
+    struct AstLoader::Impl
+    {
+        AstLoader& Loader;
+        const LoaderOptions& Options;
+        std::vector<HeaderFile>& Files;
+
+        Impl(AstLoader& InLoader, std::vector<HeaderFile>& OutFiles)
+            : Loader(InLoader), Options(InLoader.Options), Files(OutFiles)
+        {
+
+        }
+
+        // Fields of one ast object that the generator reads, filled by either loader
+        struct UnitDesc {
+            std::string Type;
+            std::string Name;
+            std::string ExportName;
+            std::string Macro;
+            std::string Comment;
+            std::string Access;
+            std::string Setter;
+            std::string File;
+            std::string Key;
+            std::string ParentClass;
+            // Return type of a function or type of a data member
+            std::string ValueType;
+            std::vector<std::string> Params;
+            std::vector<std::string> Keys;
+            std::vector<std::string> IncludeFiles;
+            std::vector<Node> Nodes;
+            int Line = 0;
+            bool HasMacro = false;
+            bool IsStatic = false;
+            // Const member function
+            bool IsConst = false;
+            bool IsVirtual = false;
+            bool IsDataStatic = false;
+            bool MetaGlobal = false;
+            bool MetaReadonly = false;
+            bool MetaNoInherit = false;
+            bool MetaValue = false;
+            bool MetaBatch = false;
+        };
+
+        // Fields of one type node, see GetParamTypeDesc
+        struct TypeDesc {
+            std::string Type;
+            std::string Name;
+            std::string Base;
+            std::vector<std::string> Params;
+            bool IsConst = false;
+            bool IsStatic = false;
+        };
+
+        static std::string JoinParams(const std::vector<std::string>& Params)
+        {
+            std::string ParamsString = "";
+            for (size_t i = 0; i < Params.size(); ++i)
+            {
+                ParamsString.append(Params[i]);
+                if (i < Params.size() - 1)
+                {
+                    ParamsString.append(", ");
+                }
+            }
+            return ParamsString;
+        }
+
+        static std::string DescribeType(const TypeDesc& Type)
+        {
+            std::string Desc = "";
+            bool IsConst = Type.IsConst;
+            if (Type.Type == "pointer")
+            {
+                Desc.append(Type.Base).append("*");
+                if (IsConst)
+                {
+                    Desc.append(" const");
+                }
+                IsConst = false;
+            }
+            else if (Type.Type == "literal")
+            {
+                Desc.append(Type.Name);
+            }
+            else if (Type.Type == "reference")
+            {
+                Desc.append(Type.Base).append("&");
+            }
+            else if (Type.Type == "lreference")
+            {
+                Desc.append(Type.Base).append("&&");
+            }
+            else if (Type.Type == "template")
+            {
+                Desc.append(Type.Name).append("<").append(JoinParams(Type.Params)).append(">");
+            }
+            else if (Type.Type == "function")
+            {
+                Desc.append(Type.Base).append("(").append(JoinParams(Type.Params)).append(")");
+            }
+
+            if (IsConst)
+            {
+                Desc.insert(0, "const ");
+            }
+
+            return Desc;
+        }
+
+        HeaderFile MakeFile(UnitDesc& Desc)
+        {
+            HeaderFile File;
+            File.Name = std::move(Desc.File);
+            File.IncludeFiles = std::move(Desc.IncludeFiles);
+            File.Nodes = std::move(Desc.Nodes);
+            std::sort(File.IncludeFiles.begin(), File.IncludeFiles.end());
+            return File;
+        }
+
+        Node MakeNamespace(UnitDesc& Desc)
+        {
+            Node Namespace(NodeKind::Namespace);
+            Namespace.Name = std::move(Desc.Name);
+            Namespace.ExportName = std::move(Desc.ExportName);
+            Namespace.ShouldExport = Desc.HasMacro;
+            Namespace.Children = std::move(Desc.Nodes);
+            return Namespace;
+        }
+
+        Node MakeEnum(UnitDesc& Desc)
+        {
+            Node Enum(NodeKind::Enum);
+            Enum.Name = std::move(Desc.Name);
+            Enum.ExportName = std::move(Desc.ExportName);
+            Enum.Comment = std::move(Desc.Comment);
+            Enum.Children.reserve(Desc.Keys.size());
+            for (auto& Key : Desc.Keys)
+            {
+                Enum.Children.emplace_back(NodeKind::EnumValue);
+                Enum.Children.back().Name = std::move(Key);
+            }
+            return Enum;
+        }
+
+        Node MakeClass(UnitDesc& Desc)
+        {
+            Node Class(NodeKind::Class);
+            Class.Name = std::move(Desc.Name);
+            Class.ExportName = std::move(Desc.ExportName);
+            if (!Desc.MetaNoInherit)
+            {
+                Class.Detail = std::move(Desc.ParentClass);
+            }
+            Class.IsValue = Desc.MetaValue;
+            Class.Children = std::move(Desc.Nodes);
+            Class.Comment = std::move(Desc.Comment);
+            return Class;
+        }
+
+        Node MakeConstructor(UnitDesc& Desc)
+        {
+            Node Constructor(NodeKind::Constructor);
+            Constructor.Detail = JoinParams(Desc.Params);
+            Constructor.Comment = std::move(Desc.Comment);
+            return Constructor;
+        }
+
+        Node MakeFunction(UnitDesc& Desc)
+        {
+            Node Function(NodeKind::Function);
+            Function.Name = std::move(Desc.Name);
+            Function.ExportName = std::move(Desc.ExportName);
+            Function.Function = FunctionType::Common;
+            Function.IsCFunction = false;
+            bool IsMemberFunc = false;
+            if (!Desc.Access.empty())
+            {
+                if (Desc.Access != "public")
+                {
+                    std::stringstream ss;
+                    ss << "Function :" << Function.Name << "must be public, Line: " << Desc.Line;
+                    throw ss.str();
+                }
+                IsMemberFunc = true;
+            }
+
+            if (Desc.IsStatic)
+            {
+                Function.Function = Desc.MetaGlobal
+                    ? FunctionType::Global
+                    : (IsMemberFunc 
+                        ? FunctionType::Static 
+                        : FunctionType::Common);
+            }
+            if (Desc.Macro == Options.FunctionPropertyMacro)
+            {
+                if (Desc.IsStatic || !IsMemberFunc)
+                {
+                    std::stringstream ss;
+                    ss << "Property :" << Function.Name << "must not be static and should be member func, Line: " << Desc.Line;
+                    throw ss.str();
+                }
+                Function.Function = FunctionType::Property;
+                Function.Detail = std::move(Desc.Setter);
+            } 
+            else if (Desc.Macro == Options.CFunctionMacro)
+            {
+                Function.IsCFunction = true;
+            }
+            Function.Signature = Desc.ValueType + "(" + JoinParams(Desc.Params) + ")";
+            Function.IsConst = Desc.IsConst;
+            Function.IsVirtual = Desc.IsVirtual;
+            Function.IsBatch = Desc.MetaBatch;
+            Function.Comment = std::move(Desc.Comment);
+            return Function;
+        }
+
+        Node MakeData(UnitDesc& Desc)
+        {
+            Node Data(NodeKind::Data);
+            Data.Name = std::move(Desc.Name);
+            Data.ExportName = std::move(Desc.ExportName);
+            Data.Writeable = !Desc.MetaReadonly;
+            Data.IsStatic = Desc.IsDataStatic;
+            Data.IsAutoNull = (Desc.Macro == Options.AutoNullMacro);
+            Data.Signature = std::move(Desc.ValueType);
+            Data.Comment = std::move(Desc.Comment);
+            return Data;
+        }
+
+        // Builds the generator model directly from reader events, so the ast is never held as a document
+        struct StreamingLoader
+        {
+            enum class FrameKind {
+                Files,
+                Unit,
+                Members,
+                Meta,
+                Type,
+                TypeList,
+                Params,
+                Param,
+                Parents,
+                Parent,
+                Skip
+            };
+
+            struct Frame {
+                FrameKind Kind;
+                std::string Key;
+                int SkipDepth;
+            };
+
+            struct ParentDesc {
+                std::string Access;
+                std::string Name;
+                bool IsLiteral = false;
+            };
+
+            Impl& Owner;
+            std::vector<Frame> Frames;
+            std::vector<UnitDesc> Units;
+            std::vector<TypeDesc> Types;
+            std::vector<ParentDesc> Parents;
+            std::vector<std::string> ParamTypes;
+
+            StreamingLoader(Impl& InOwner)
+                : Owner(InOwner)
+            {
+
+            }
+
+            Frame& Top()
+            {
+                return Frames.back();
+            }
+
+            void Push(FrameKind Kind)
+            {
+                Frames.push_back(Frame{ Kind, std::string(), 1 });
+                switch (Kind)
+                {
+                case FrameKind::Unit:
+                    Units.emplace_back();
+                    break;
+                case FrameKind::Type:
+                    Types.emplace_back();
+                    break;
+                case FrameKind::Param:
+                    ParamTypes.emplace_back();
+                    break;
+                case FrameKind::Parent:
+                    Parents.emplace_back();
+                    break;
+                default:
+                    break;
+                }
+            }
+
+            static bool AcceptsChild(const UnitDesc& Parent, const std::string& ChildType)
+            {
+                if (Parent.Type.empty())
+                {
+                    return ChildType == "class" || ChildType == "function" || ChildType == "include" || ChildType == "enum" || ChildType == "namespace";
+                }
+                if (Parent.Type == "namespace")
+                {
+                    return ChildType == "class" || ChildType == "function" || ChildType == "enum";
+                }
+                if (Parent.Type == "class")
+                {
+                    return ChildType == "function" || ChildType == "property" || ChildType == "enum" || ChildType == "constructor";
+                }
+                return false;
+            }
+
+            Node BuildNode(UnitDesc& Desc)
+            {
+                if (Desc.Type == "class")
+                {
+                    return Owner.MakeClass(Desc);
+                }
+                else if (Desc.Type == "function")
+                {
+                    return Owner.MakeFunction(Desc);
+                }
+                else if (Desc.Type == "enum")
+                {
+                    return Owner.MakeEnum(Desc);
+                }
+                else if (Desc.Type == "namespace")
+                {
+                    return Owner.MakeNamespace(Desc);
+                }
+                else if (Desc.Type == "property")
+                {
+                    return Owner.MakeData(Desc);
+                }
+                return Owner.MakeConstructor(Desc);
+            }
+
+            void EndUnit()
+            {
+                UnitDesc Desc = std::move(Units.back());
+                Units.pop_back();
+                Frames.pop_back();
+                if (Top().Kind == FrameKind::Files)
+                {
+                    Owner.Files.push_back(Owner.MakeFile(Desc));
+                    return;
+                }
+
+                auto& Parent = Units.back();
+                if (Desc.Type.empty())
+                {
+                    if (Parent.Type == "enum")
+                    {
+                        Parent.Keys.push_back(std::move(Desc.Key));
+                    }
+                }
+                else if (Desc.Type == "include")
+                {
+                    Parent.IncludeFiles.push_back(std::move(Desc.File));
+                }
+                else
+                {
+                    Parent.Nodes.push_back(BuildNode(Desc));
+                }
+            }
+
+            void EndType()
+            {
+                TypeDesc Desc = std::move(Types.back());
+                Types.pop_back();
+                Frames.pop_back();
+                switch (Top().Kind)
+                {
+                case FrameKind::Unit:
+                    if (Top().Key == "dataType")
+                    {
+                        Units.back().IsDataStatic = Desc.IsStatic;
+                    }
+                    Units.back().ValueType = DescribeType(Desc);
+                    break;
+                case FrameKind::Type:
+                    Types.back().Base = DescribeType(Desc);
+                    break;
+                case FrameKind::TypeList:
+                    Types.back().Params.push_back(DescribeType(Desc));
+                    break;
+                case FrameKind::Param:
+                    ParamTypes.back() = DescribeType(Desc);
+                    break;
+                case FrameKind::Parent:
+                    Parents.back().IsLiteral = (Desc.Type == "literal");
+                    Parents.back().Name = std::move(Desc.Name);
+                    break;
+                default:
+                    break;
+                }
+            }
+
+            void EndParam()
+            {
+                std::string Desc = std::move(ParamTypes.back());
+                ParamTypes.pop_back();
+                Frames.pop_back();
+                // The params array belongs to the frame below it, either a constructor/function unit or a function type
+                auto& ArrayOwner = Frames[Frames.size() - 2];
+                if (ArrayOwner.Kind == FrameKind::Unit)
+                {
+                    Units.back().Params.push_back(std::move(Desc));
+                }
+                else if (ArrayOwner.Kind == FrameKind::Type)
+                {
+                    Types.back().Params.push_back(std::move(Desc));
+                }
+            }
+
+            void EndParent()
+            {
+                ParentDesc Desc = std::move(Parents.back());
+                Parents.pop_back();
+                Frames.pop_back();
+                auto& Class = Units.back();
+                if (Class.ParentClass.empty() && Desc.Access == "public" && Desc.IsLiteral)
+                {
+                    Class.ParentClass = std::move(Desc.Name);
+                }
+            }
+
+            bool SetString(const std::string& Value)
+            {
+                auto& Key = Top().Key;
+                switch (Top().Kind)
+                {
+                case FrameKind::Unit:
+                {
+                    auto& Unit = Units.back();
+                    if (Key == "type")
+                    {
+                        Unit.Type = Value;
+                        // Units the parent does not accept are skipped without building anything
+                        if (Frames[Frames.size() - 2].Kind == FrameKind::Members && !AcceptsChild(Units[Units.size() - 2], Unit.Type))
+                        {
+                            Units.pop_back();
+                            Top().Kind = FrameKind::Skip;
+                        }
+                    }
+                    else if (Key == "name")
+                    {
+                        Unit.Name = Value;
+                    }
+                    else if (Key == "macro")
+                    {
+                        Unit.Macro = Value;
+                        Unit.HasMacro = true;
+                    }
+                    else if (Key == "comment")
+                    {
+                        Unit.Comment = Value;
+                    }
+                    else if (Key == "access")
+                    {
+                        Unit.Access = Value;
+                    }
+                    else if (Key == "file")
+                    {
+                        Unit.File = Value;
+                        if (Frames[Frames.size() - 2].Kind == FrameKind::Files)
+                        {
+                            Owner.Loader.Current = Value;
+                        }
+                    }
+                    else if (Key == "key")
+                    {
+                        Unit.Key = Value;
+                    }
+                    break;
+                }
+                case FrameKind::Meta:
+                    if (Key == "name")
+                    {
+                        Units.back().ExportName = Value;
+                    }
+                    else if (Key == "setter")
+                    {
+                        Units.back().Setter = Value;
+                    }
+                    break;
+                case FrameKind::Type:
+                    if (Key == "type")
+                    {
+                        Types.back().Type = Value;
+                    }
+                    else if (Key == "name")
+                    {
+                        Types.back().Name = Value;
+                    }
+                    break;
+                case FrameKind::Parent:
+                    if (Key == "access")
+                    {
+                        Parents.back().Access = Value;
+                    }
+                    break;
+                default:
+                    break;
+                }
+                return true;
+            }
+
+            bool SetBool(bool Value)
+            {
+                auto& Key = Top().Key;
+                if (Top().Kind == FrameKind::Unit && Key == "static")
+                {
+                    Units.back().IsStatic = Value;
+                }
+                else if (Top().Kind == FrameKind::Unit && Key == "const")
+                {
+                    Units.back().IsConst = Value;
+                }
+                else if (Top().Kind == FrameKind::Unit && Key == "virtual")
+                {
+                    Units.back().IsVirtual = Value;
+                }
+                else if (Top().Kind == FrameKind::Type)
+                {
+                    if (Key == "const")
+                    {
+                        Types.back().IsConst = Value;
+                    }
+                    else if (Key == "static")
+                    {
+                        Types.back().IsStatic = Value;
+                    }
+                }
+                return true;
+            }
+
+            bool SetNumber(int64_t Value)
+            {
+                if (Top().Kind == FrameKind::Unit && Top().Key == "line")
+                {
+                    Units.back().Line = (int)Value;
+                }
+                return true;
+            }
+
+            bool Null()
+            {
+                return true;
+            }
+
+            bool Bool(bool b)
+            {
+                return Frames.empty() || SetBool(b);
+            }
+
+            bool Int(int i)
+            {
+                return Frames.empty() || SetNumber(i);
+            }
+
+            bool Uint(unsigned u)
+            {
+                return Frames.empty() || SetNumber(u);
+            }
+
+            bool Int64(int64_t i)
+            {
+                return Frames.empty() || SetNumber(i);
+            }
+
+            bool Uint64(uint64_t u)
+            {
+                return Frames.empty() || SetNumber((int64_t)u);
+            }
+
+            bool Double(double)
+            {
+                return true;
+            }
+
+            bool RawNumber(const char*, SizeType, bool)
+            {
+                return true;
+            }
+
+            bool String(const char* str, SizeType length, bool)
+            {
+                return Frames.empty() || SetString(std::string(str, length));
+            }
+
+            bool Key(const char* str, SizeType length, bool)
+            {
+                if (Frames.empty() || Top().Kind == FrameKind::Skip)
+                {
+                    return true;
+                }
+                Top().Key.assign(str, length);
+                if (Top().Kind == FrameKind::Meta)
+                {
+                    auto& Unit = Units.back();
+                    auto& Key = Top().Key;
+                    Unit.MetaGlobal |= (Key == "global");
+                    Unit.MetaReadonly |= (Key == "readonly");
+                    Unit.MetaNoInherit |= (Key == "noinherit");
+                    Unit.MetaValue |= (Key == "value");
+                    Unit.MetaBatch |= (Key == "batch");
+                }
+                return true;
+            }
+
+            bool StartObject()
+            {
+                if (Frames.empty())
+                {
+                    throw std::string("Ast root must be an array of files");
+                }
+                auto& Key = Top().Key;
+                switch (Top().Kind)
+                {
+                case FrameKind::Files:
+                case FrameKind::Members:
+                    Push(FrameKind::Unit);
+                    break;
+                case FrameKind::Unit:
+                    if (Key == "meta")
+                    {
+                        Push(FrameKind::Meta);
+                    }
+                    else if (Key == "returnType" || Key == "dataType")
+                    {
+                        Push(FrameKind::Type);
+                    }
+                    else
+                    {
+                        Push(FrameKind::Skip);
+                    }
+                    break;
+                case FrameKind::Type:
+                    Push((Key == "baseType" || Key == "returnType") ? FrameKind::Type : FrameKind::Skip);
+                    break;
+                case FrameKind::TypeList:
+                    Push(FrameKind::Type);
+                    break;
+                case FrameKind::Params:
+                    Push(FrameKind::Param);
+                    break;
+                case FrameKind::Param:
+                    Push(Key == "type" ? FrameKind::Type : FrameKind::Skip);
+                    break;
+                case FrameKind::Parents:
+                    Push(FrameKind::Parent);
+                    break;
+                case FrameKind::Parent:
+                    Push(Key == "name" ? FrameKind::Type : FrameKind::Skip);
+                    break;
+                case FrameKind::Meta:
+                    Push(FrameKind::Skip);
+                    break;
+                case FrameKind::Skip:
+                    Top().SkipDepth++;
+                    break;
+                }
+                return true;
+            }
+
+            bool EndObject(SizeType)
+            {
+                switch (Top().Kind)
+                {
+                case FrameKind::Unit:
+                    EndUnit();
+                    break;
+                case FrameKind::Type:
+                    EndType();
+                    break;
+                case FrameKind::Param:
+                    EndParam();
+                    break;
+                case FrameKind::Parent:
+                    EndParent();
+                    break;
+                case FrameKind::Skip:
+                    if (--Top().SkipDepth == 0)
+                    {
+                        Frames.pop_back();
+                    }
+                    break;
+                default:
+                    Frames.pop_back();
+                    break;
+                }
+                return true;
+            }
+
+            bool StartArray()
+            {
+                if (Frames.empty())
+                {
+                    Push(FrameKind::Files);
+                    return true;
+                }
+                auto& Key = Top().Key;
+                switch (Top().Kind)
+                {
+                case FrameKind::Unit:
+                    if (Key == "content" || Key == "members")
+                    {
+                        Push(FrameKind::Members);
+                    }
+                    else if (Key == "parameters")
+                    {
+                        Push(FrameKind::Params);
+                    }
+                    else if (Key == "parents")
+                    {
+                        Push(FrameKind::Parents);
+                    }
+                    else
+                    {
+                        Push(FrameKind::Skip);
+                    }
+                    break;
+                case FrameKind::Type:
+                    if (Key == "parameters")
+                    {
+                        Push(Types.back().Type == "template" ? FrameKind::TypeList : FrameKind::Params);
+                    }
+                    else
+                    {
+                        Push(FrameKind::Skip);
+                    }
+                    break;
+                case FrameKind::Skip:
+                    Top().SkipDepth++;
+                    break;
+                default:
+                    Push(FrameKind::Skip);
+                    break;
+                }
+                return true;
+            }
+
+            bool EndArray(SizeType)
+            {
+                if (Top().Kind == FrameKind::Skip && --Top().SkipDepth != 0)
+                {
+                    return true;
+                }
+                Frames.pop_back();
+                return true;
+            }
+        };
+
+        bool LoadStreaming(const std::string& InputFile)
+        {
+            stats::ScopedSpan Span("load ast", InputFile);
+            // Files holds the headers of every ast loaded before, only this one's are counted
+            auto HeadersBefore = Files.size();
+            std::unique_ptr<FILE, int(*)(FILE*)> fp(std::fopen(InputFile.c_str(), "rb"), &std::fclose);
+            if (!fp)
+            {
+                std::cerr << "Could not open " << InputFile << std::endl;
+                return false;
+            }
+
+            std::vector<char> ReadBuffer(64 * 1024);
+            FileReadStream Stream(fp.get(), ReadBuffer.data(), ReadBuffer.size());
+            StreamingLoader Loader(*this);
+            Reader reader;
+            ParseResult Result = reader.Parse(Stream, Loader);
+            if (Result.IsError())
+            {
+                std::stringstream ss;
+                ss << "Invalid ast json: " << GetParseError_En(Result.Code()) << " Offset: " << Result.Offset();
+                throw ss.str();
+            }
+            Span.Counter("bytes", Stream.Tell());
+            Span.Counter("headers", Files.size() - HeadersBefore);
+            return true;
+        }
+
+        bool LoadDocument(const std::string& InputFile)
+        {
+            std::stringstream buffer;
+            {
+                stats::ScopedSpan Span("read", InputFile);
+                std::ifstream ifs(InputFile);
+                if (!ifs.is_open()) {
+                    std::cerr << "Could not open " << InputFile << std::endl;
+                    return false;
+                }
+                buffer << ifs.rdbuf();
+                ifs.close();
+                // The put position is the size read, str() would copy the whole file. An empty file leaves -1.
+                auto Size = buffer.tellp();
+                Span.Counter("bytes", Size > 0 ? static_cast<uint64_t>(Size) : 0);
+            }
+
+            stats::ScopedSpan Span("load ast", InputFile);
+            auto HeadersBefore = Files.size();
+            Document document;
+            document.Parse(buffer.str().c_str());
+            if (document.HasParseError())
+            {
+                std::stringstream ss;
+                ss << "Invalid ast json: " << GetParseError_En(document.GetParseError()) << " Offset: " << document.GetErrorOffset();
+                throw ss.str();
+            }
+            ParseDocument(document);
+            Span.Counter("headers", Files.size() - HeadersBefore);
+            return true;
+        }
+
+        void ParseDocument(const Document& document)
+        {
+            if (!document.IsArray())
+            {
+                throw std::string("Ast root must be an array of files");
+            }
+            for (SizeType i = 0; i < document.Size(); ++i)
+            {
+                Files.push_back(ParseFile(document[i]));
+            }
+        }
+
+        HeaderFile ParseFile(const Document::ValueType& FileObject)
+        {
+            UnitDesc Desc;
+            Desc.File = FileObject["file"].GetString();
+            Loader.Current = Desc.File;
+            auto& ContentArray = FileObject["content"];
+            for (SizeType i = 0; i < ContentArray.Size(); ++i)
+            {
+                auto& Unit = ContentArray[i];
+                std::string type = Unit["type"].GetString();
+                if (type == "class")
+                {
+                    Desc.Nodes.push_back(ParseClass(Unit));
+                }
+                else if (type == "function")
+                {
+                    Desc.Nodes.push_back(ParseFunction(Unit));
+                }
+                else if (type == "include")
+                {
+                    Desc.IncludeFiles.push_back(Unit["file"].GetString());
+                }
+                else if (type == "enum")
+                {
+                    Desc.Nodes.push_back(ParseEnum(Unit));
+                }
+                else if (type == "namespace")
+                {
+                    Desc.Nodes.push_back(ParseNamespace(Unit));
+                }
+            }
+            return MakeFile(Desc);
+        }
+
+        void TryGetComment(const Document::ValueType& Object, std::string& Comment) 
+        {
+            auto itr = Object.FindMember("comment");
+            if (itr != Object.MemberEnd())
+            {
+                Comment = itr->value.GetString();
+            }
+        }
+
+        Node ParseNamespace(const Document::ValueType& NamespaceObject)
+        {
+            UnitDesc Desc;
+            Desc.Name = NamespaceObject["name"].GetString();
+            Desc.HasMacro = NamespaceObject.HasMember("macro");
+            TryGetExportName(NamespaceObject, Desc.ExportName);
+            auto& NamespaceMembers = NamespaceObject["members"];
+            for (SizeType i = 0; i < NamespaceMembers.Size(); ++i)
+            {
+                auto& Unit = NamespaceMembers[i];
+                std::string type = Unit["type"].GetString();
+                if (type == "class")
+                {
+                    Desc.Nodes.push_back(ParseClass(Unit));
+                }
+                else if (type == "function")
+                {
+                    Desc.Nodes.push_back(ParseFunction(Unit));
+                }
+                else if (type == "enum")
+                {
+                    Desc.Nodes.push_back(ParseEnum(Unit));
+                }
+            }
+            return MakeNamespace(Desc);
+        }
+
+        void TryGetExportName(const Document::ValueType& Object, std::string& Name)
+        {
+            auto itrMeta = Object.FindMember("meta");
+            if (itrMeta != Object.MemberEnd())
+            {
+                auto itr = itrMeta->value.FindMember("name");
+                if (itr != itrMeta->value.MemberEnd())
+                {
+                    Name = itr->value.GetString();
+                }
+            }
+
+        }
+
+        Node ParseEnum(const Document::ValueType& EnumObject)
+        {
+            UnitDesc Desc;
+            Desc.Name = EnumObject["name"].GetString();
+            TryGetExportName(EnumObject, Desc.ExportName);
+            auto& EnumMembers = EnumObject["members"];
+            for (SizeType i = 0; i < EnumMembers.Size(); ++i)
+            {
+                Desc.Keys.push_back(EnumMembers[i]["key"].GetString());
+            }
+            TryGetComment(EnumObject, Desc.Comment);
+            return MakeEnum(Desc);
+        }
+
+        Node ParseClass(const Document::ValueType& ClassObject)
+        {
+            UnitDesc Desc;
+            Desc.Name = ClassObject["name"].GetString();
+            TryGetExportName(ClassObject, Desc.ExportName);
+            Desc.MetaNoInherit = ClassObject["meta"].HasMember("noinherit");
+            Desc.MetaValue = ClassObject["meta"].HasMember("value");
+            GetClassParent(ClassObject, Desc.ParentClass);
+
+            auto& ClassMembers = ClassObject["members"];
+            for (SizeType i = 0; i < ClassMembers.Size(); ++i)
+            {
+                auto& Unit = ClassMembers[i];
+                std::string type = Unit["type"].GetString();
+                if (type == "function")
+                {
+                    Desc.Nodes.push_back(ParseFunction(Unit));
+                }
+                else if (type == "property")
+                {
+                    Desc.Nodes.push_back(ParseData(Unit));
+                }
+                else if (type == "enum")
+                {
+                    Desc.Nodes.push_back(ParseEnum(Unit));
+                }
+                else if (type == "constructor")
+                {
+                    Desc.Nodes.push_back(ParseConstructor(Unit));
+                }
+            }
+            TryGetComment(ClassObject, Desc.Comment);
+            return MakeClass(Desc);
+        }
+
+        void GetParamsArrayDesc(const Document::ValueType& Params, bool OnlyType, std::vector<std::string>& OutParams)
+        {
+            for (SizeType i = 0; i < Params.Size(); ++i)
+            {
+                auto& Param = OnlyType ? Params[i] : Params[i]["type"];
+                OutParams.push_back(GetParamTypeDesc(Param));
+            }
+        }
+
+        std::string GetParamTypeDesc(const Document::ValueType& TypeObject)
+        {
+            TypeDesc Desc;
+            auto ConstItr = TypeObject.FindMember("const");
+            Desc.Type = TypeObject["type"].GetString();
+            Desc.IsConst = (ConstItr != TypeObject.MemberEnd() && ConstItr->value.GetBool());
+            if (Desc.Type == "pointer" || Desc.Type == "reference" || Desc.Type == "lreference")
+            {
+                Desc.Base = GetParamTypeDesc(TypeObject["baseType"]);
+            }
+            else if (Desc.Type == "literal")
+            {
+                Desc.Name = TypeObject["name"].GetString();
+            }
+            else if (Desc.Type == "template")
+            {
+                Desc.Name = TypeObject["name"].GetString();
+                GetParamsArrayDesc(TypeObject["parameters"], true, Desc.Params);
+            }
+            else if (Desc.Type == "function")
+            {
+                Desc.Base = GetParamTypeDesc(TypeObject["returnType"]);
+                GetParamsArrayDesc(TypeObject["parameters"], false, Desc.Params);
+            }
+            return DescribeType(Desc);
+        }
+
+        Node ParseConstructor(const Document::ValueType& ConstructorObject)
+        {
+            UnitDesc Desc;
+            GetParamsArrayDesc(ConstructorObject["parameters"], false, Desc.Params);
+            TryGetComment(ConstructorObject, Desc.Comment);
+            return MakeConstructor(Desc);
+        }
+
+        Node ParseFunction(const Document::ValueType& FunctionObject)
+        {
+            UnitDesc Desc;
+            Desc.Name = FunctionObject["name"].GetString();
+            Desc.Line = FunctionObject["line"].GetInt();
+            Desc.Macro = FunctionObject["macro"].GetString();
+            TryGetExportName(FunctionObject, Desc.ExportName);
+            auto itr = FunctionObject.FindMember("access");
+            if (itr != FunctionObject.MemberEnd())
+            {
+                Desc.Access = itr->value.GetString();
+            }
+            itr = FunctionObject.FindMember("static");
+            if (itr != FunctionObject.MemberEnd())
+            {
+                Desc.IsStatic = itr->value.GetBool();
+            }
+            itr = FunctionObject.FindMember("const");
+            if (itr != FunctionObject.MemberEnd())
+            {
+                Desc.IsConst = itr->value.GetBool();
+            }
+            itr = FunctionObject.FindMember("virtual");
+            if (itr != FunctionObject.MemberEnd())
+            {
+                Desc.IsVirtual = itr->value.GetBool();
+            }
+            auto itrMeta = FunctionObject.FindMember("meta");
+            if (itrMeta != FunctionObject.MemberEnd())
+            {
+                Desc.MetaGlobal = itrMeta->value.HasMember("global");
+                Desc.MetaBatch = itrMeta->value.HasMember("batch");
+                auto itrSetter = itrMeta->value.FindMember("setter");
+                if (itrSetter != itrMeta->value.MemberEnd())
+                {
+                    Desc.Setter = itrSetter->value.GetString();
+                }
+            }
+            itr = FunctionObject.FindMember("returnType");
+            if (itr != FunctionObject.MemberEnd())
+            {
+                Desc.ValueType = GetParamTypeDesc(itr->value);
+            }
+            itr = FunctionObject.FindMember("parameters");
+            if (itr != FunctionObject.MemberEnd())
+            {
+                GetParamsArrayDesc(itr->value, false, Desc.Params);
+            }
+            TryGetComment(FunctionObject, Desc.Comment);
+            return MakeFunction(Desc);
+        }
+
+        Node ParseData(const Document::ValueType& DataObject)
+        {
+            UnitDesc Desc;
+            Desc.Name = DataObject["name"].GetString();
+            Desc.Macro = DataObject["macro"].GetString();
+            TryGetExportName(DataObject, Desc.ExportName);
+            Desc.MetaReadonly = DataObject["meta"].HasMember("readonly");
+            Desc.IsDataStatic = DataObject["dataType"].HasMember("static");
+            Desc.ValueType = GetParamTypeDesc(DataObject["dataType"]);
+            TryGetComment(DataObject, Desc.Comment);
+            return MakeData(Desc);
+        }
+
+        bool GetClassParent(const Document::ValueType& ClassObject, std::string& OutParentClassName)
+        {
+            auto itr = ClassObject.FindMember("parents");
+            if (itr == ClassObject.MemberEnd())
+            {
+                return false;
+            }
+            auto &ParentsArray = itr->value;
+            for (SizeType i = 0; i < ParentsArray.Size(); ++i)
+            {
+                auto& ParentObject = ParentsArray[i];
+                if (std::string(ParentObject["access"].GetString()) != "public")
+                {
+                    continue;
+                }
+                auto& ParentName = ParentObject["name"];
+                if (std::string(ParentName["type"].GetString()) != "literal")
+                {
+                    continue;
+                }
+                OutParentClassName = ParentName["name"].GetString();
+                return true;
+            }
+            return false;
+        }
+    };
+
+    AstLoader::AstLoader(const LoaderOptions& options)
+        : Options(options)
+    {
+
+    }
+
+    bool AstLoader::Load(const std::string& InputFile, std::vector<HeaderFile>& OutFiles)
+    {
+        Impl impl(*this, OutFiles);
+        return Options.Streaming ? impl.LoadStreaming(InputFile) : impl.LoadDocument(InputFile);
+    }
+
+}
@@ -1,754 +1,2429 @@
 #include "CodeGenerator.h"
+#include "AstModel.h"
+#include "AstLoader.h"
+#include "Stats.h"
 
 #include <sstream>
-#include <fstream>
 #include <iostream>
-#include <list>
-#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <algorithm>
+#include <functional>
+#include <cctype>
+#include <cstring>
 #include <memory> 
+#include <initializer_list>
+#include <vector>
+#include <thread>
+#include <atomic>
 
-#include <rapidjson/rapidjson.h>
-#include <rapidjson/document.h>
-
-using namespace rapidjson;
+using lab::Node;
+using lab::NodeKind;
+using lab::FunctionType;
+using lab::HeaderFile;
 
 struct CodeGenerator::Impl
 {
-
-    struct ContentNode {
-        std::string Name;
-        std::string ExportName;
-        virtual ~ContentNode() {};
-    };
-
-    enum class FunctionType {
-        Common,
-        Static,
-        Global,
-        Property
-    };
-
-    struct LuaFunction : ContentNode {
-        std::string Comment;
-        std::string SetterName;
-        FunctionType Type;
-        bool IsCFunction = false;
-    };
-
-    struct CppClassConstructor : ContentNode {
-        std::string Comment;
-        std::string Params;
-    };
-
-    struct LuaData : ContentNode {
-        std::string Comment;
-        bool Writeable;
-        bool IsStatic;
-        bool IsAutoNull;
-    };
-
-    struct LuaEnum : ContentNode {
-        std::list<std::string> Keys;
-        std::string Comment;
-    };
-
-    struct LuaClass : ContentNode {
-        std::string ParentClass;
-        std::list<std::shared_ptr<ContentNode>> Nodes;
-        std::string Comment;
-    };
-
-    struct CxxNamespace : ContentNode {
-        std::list<std::shared_ptr<ContentNode>> Nodes;
-        bool bShouldExport;
+    // Generated code of one header, kept apart so headers can be generated in any order and on any thread
+    struct Fragment
+    {
+        std::stringstream ssInclude;
+        std::stringstream ssNormal;
+        std::stringstream ssGlobal;
+        std::stringstream ssAutoNull;
+        // Chain of RegisterAPIsDelta, only filled when there is a previous ast
+        std::stringstream ssDelta;
+        std::stringstream ssDeltaGlobal;
+        std::stringstream ssRemoved;
+        // Statements run after the chain: shared thunks (ThunkMode::Shared) and field tables (DataMode::Offset)
+        std::stringstream ssThunk;
+        std::stringstream ssDeltaThunk;
+        // Generated lua_CFunctions of ThunkMode::Direct and ThunkMode::Table, defined ahead of the registration functions
+        std::stringstream ssDirect;
+        // FfiMode::Shims: ffi.cdef declarations of the shims, lua lines wrapping them, classes given FfiAddress
+        std::stringstream ssFfiCdef;
+        std::stringstream ssFfiLua;
+        std::unordered_set<const Node*> FfiClasses;
+        // Identifier made from the header name, keeps thunk names of different headers apart
+        std::string FilePrefix;
+        // One entry per thunk bound, naming the thunk instantiation it needs
+        std::vector<std::string> ThunkKeys;
+        // ProfileMode::Calls: lua name of every counted thunk, its index is the thunk's slot in the profile array
+        std::vector<std::string> Profiled;
+
+        // Where the walk currently is: the innermost class and the lua path of the exported namespaces
+        const Node* Class = nullptr;
+        std::string LuaPath;
+        // Field table entries of the innermost class, null where data goes through the chain
+        std::stringstream* Fields = nullptr;
+        // Member of the innermost class as IndexMode::Hash dispatches it
+        struct IndexMember
+        {
+            std::string Name;
+            std::string Get;
+            // Empty for methods and read only members
+            std::string Set;
+            bool IsMethod;
+            // Reachable from const objects
+            bool IsConst;
+        };
+        // luaL_Reg entries of the innermost class for ThunkMode::Table and value classes, null where thunks are bound one by one
+        struct FunctionTables
+        {
+            std::stringstream Methods;
+            // Installed into the class and the const table
+            std::stringstream ConstMethods;
+            std::stringstream Statics;
+            std::stringstream Getters;
+            // Installed into the getter tables of both the class and its const objects
+            std::stringstream ConstGetters;
+            std::stringstream Setters;
+            // Members dispatched by IndexMode::Hash, in declaration order
+            std::vector<IndexMember> Index;
+            // Data members and constructor thunk of a value class
+            std::vector<std::string> Fields;
+            std::string Constructor;
+        };
+        FunctionTables* Tables = nullptr;
+
+        // Top level namespaces deferred by RegisterMode::Lazy, a namespace opened twice in a header has two
+        struct Module
+        {
+            std::string Name;
+            std::string Normal;
+            std::string Thunk;
+        };
+        std::vector<Module> Modules;
+        // Lazy namespace being generated, empty while generating what RegisterAPIs builds itself
+        std::string ModuleName;
+        // Where shared thunks of global functions go, they are registered eagerly even when declared in a lazy namespace
+        std::stringstream* GlobalThunk = nullptr;
+        // Lazy namespace of every class generated, and the bases they derive from, so a namespace can load its bases first
+        std::vector<std::pair<std::string, std::string>> ClassModules;
+        struct BaseClass
+        {
+            std::string Module;
+            std::string Scope;
+            std::string Name;
+        };
+        std::vector<BaseClass> Bases;
     };
 
-    struct HeaderFile : ContentNode {
-        std::list<std::string> IncludeFiles;
-        std::list<std::shared_ptr<ContentNode>> Nodes;
-    };
+    std::vector<HeaderFile> Files;
+    // Parallel to Files
+    std::vector<Fragment> Fragments;
+    bool bGenerated = false;
+
+    // Every path suffix that starts at a component, "a/b.h" is indexed as "a/b.h" and "b.h"
+    std::unordered_map<std::string, std::vector<size_t>> FileIndex;
+
+    // Ast the running process registered from, the delta registration brings it up to Files
+    std::vector<HeaderFile> PreviousFiles;
+    std::unordered_map<std::string, size_t> PreviousIndex;
+    std::vector<std::string> RemovedFiles;
+
+    lab::LoaderOptions Options;
+    unsigned Jobs = 0;
+    CodeGenerator::ThunkMode Thunks = CodeGenerator::ThunkMode::Portal;
+    CodeGenerator::DataMode Data = CodeGenerator::DataMode::Portal;
+    CodeGenerator::RegisterMode Register = CodeGenerator::RegisterMode::Eager;
+    CodeGenerator::IndexMode Index = CodeGenerator::IndexMode::Portal;
+    CodeGenerator::InheritMode Inherit = CodeGenerator::InheritMode::Chain;
+    CodeGenerator::PointerMode Pointers = CodeGenerator::PointerMode::New;
+    CodeGenerator::StringMode Strings = CodeGenerator::StringMode::Copy;
+    CodeGenerator::EnumMode Enums = CodeGenerator::EnumMode::Portal;
+    CodeGenerator::FfiMode Ffi = CodeGenerator::FfiMode::Off;
+    CodeGenerator::ProfileMode Profile = CodeGenerator::ProfileMode::Off;
+    // Lazy namespace of each class by qualified name, for RegisterMode::Lazy
+    std::unordered_map<std::string, std::string> ClassModule;
+    // Kind of every class and enum of the ast by qualified name, for direct thunks
+    std::unordered_map<std::string, NodeKind> TypeIndex;
+    // Classes of the ast declared LUA_CLASS(value), by qualified name
+    std::unordered_set<std::string> ValueClasses;
 
-    friend bool operator<(const std::shared_ptr<HeaderFile>& lhs,const std::shared_ptr<HeaderFile>& rhs)
+    Impl()
     {
-        return lhs->Name < rhs->Name;
-    }
-
-    std::stringstream ssInclude;
-    std::stringstream ssNormal;
-    std::stringstream ssGlobal;
-    std::stringstream ssAutoNull;
-
-    std::list<std::shared_ptr<HeaderFile>> Files;
-    std::set<std::shared_ptr<HeaderFile>> UnregistedFiles;
-    std::set<std::shared_ptr<HeaderFile>> RegistedFiles;
-
-    std::string CurrentFile;
-    std::string AutoNullMacro;
-    std::string FunctionPropertyMacro;
-    std::string CFunctionMacro;
 
-    Document document;
+    }
 
-    static inline std::string& GetExportName(const std::shared_ptr<ContentNode>& Node)
+    // Whether functions get generated lua_CFunctions
+    bool IsDirect() const
     {
-        return Node->ExportName.empty() ? Node->Name : Node->ExportName;
+        return Thunks == CodeGenerator::ThunkMode::Direct || Thunks == CodeGenerator::ThunkMode::Table;
     }
 
-    Impl()
+    // Value classes are bound by lab/Value.h through generated thunks, without them they are bound like any class
+    bool IsValueClass(const Node* Class) const
     {
-
+        return Class && Class->IsValue && IsDirect();
     }
 
-    bool ParseAST(const std::string& InputFile)
+    bool ParseAST(const std::string& InputFile, std::vector<HeaderFile>& Into)
     {
-        std::ifstream ifs(InputFile);
-        if (!ifs.is_open()) {
-            std::cerr << "Could not open " << InputFile << std::endl;
-            return false;
-        }
-        std::stringstream buffer;
-        buffer << ifs.rdbuf();
-        ifs.close();
-        document.Parse(buffer.str().c_str());
-
-        std::shared_ptr<ContentNode> test = std::make_shared<HeaderFile>();
-
+        bGenerated = false;
+        lab::AstLoader Loader(Options);
         try
         {
-            ParseDocument(document);
-            GenerateCode();
+            if (!Loader.Load(InputFile, Into))
+            {
+                return false;
+            }
         }
         catch (std::string e)
         {
-            std::cerr << " Error: " << e << " Current File :" << CurrentFile << std::endl;
+            std::cerr << " Error: " << e << " Current File :" << Loader.CurrentFile() << std::endl;
             return false;
         }
-
         return true;
     }
 
+    // Generates every file into its own fragment, spread over Jobs threads
     void GenerateCode()
     {
-        ssInclude << "#include <lua.hpp>\n#include <luaportal/luaportal.h>\n";
-        for (auto& file : Files)
+        if (bGenerated)
         {
-            GenerateFile(file);
+            return;
         }
-    }
-
-    bool IsEmptyNode(const std::shared_ptr<ContentNode>& Node)
-    {
-        if (Node == nullptr)
+        bGenerated = true;
+        SortFiles(Files);
+        if (!PreviousFiles.empty())
         {
-            return true;
+            SortFiles(PreviousFiles);
+            IndexPreviousFiles();
         }
-        auto NSNode = dynamic_cast<CxxNamespace*>(Node.get());
-        if (NSNode == nullptr)
+        Fragments = std::vector<Fragment>(Files.size());
+        if (IsDirect() || Ffi == CodeGenerator::FfiMode::Shims)
         {
-            return false;
+            IndexTypes();
         }
-        else 
+
+        size_t Workers = Jobs ? Jobs : std::max(1u, std::thread::hardware_concurrency());
+        Workers = std::max<size_t>(std::min(Workers, Files.size()), 1);
+        std::atomic<size_t> Next(0);
+        auto Work = [&]()
         {
-            for (auto& SubNode : NSNode->Nodes)
+            for (size_t Index = Next++; Index < Files.size(); Index = Next++)
             {
-                if (!IsEmptyNode(SubNode))
+                stats::ScopedSpan Span("emit/file", Files[Index].Name);
+                GenerateFile(Files[Index], Fragments[Index]);
+                if (!PreviousFiles.empty())
                 {
-                    return false;
+                    GenerateFileDelta(Files[Index], Fragments[Index]);
                 }
             }
-        }
-        return true;
-    }
-
-    bool isEmptyFile(const std::shared_ptr<HeaderFile>& File)
-    {
-        if (File == nullptr)
+        };
+        std::vector<std::thread> Threads;
+        for (size_t i = 1; i < Workers; ++i)
         {
-            return true;
+            Threads.emplace_back(Work);
         }
-        if (File->Nodes.empty())
+        Work();
+        for (auto& Thread : Threads)
         {
-            return true;
+            Thread.join();
         }
-        for (auto& Node : File->Nodes)
+        for (auto& Item : Fragments)
         {
-            if (!IsEmptyNode(Node))
+            for (auto& Class : Item.ClassModules)
             {
-                return false;
+                ClassModule.emplace(Class.first, Class.second);
             }
         }
-        return true;
     }
 
-    void GenerateFile(const std::shared_ptr<HeaderFile>& File)
+    // Assembles the fragments of the given files, in order, into a translation unit whose functions end with Suffix
+    std::string ComposeUnit(const std::vector<size_t>& FileIndices, const std::string& Suffix)
     {
-        if (RegistedFiles.find(File) != RegistedFiles.end())
+        std::stringstream ss;
+        ss << "#include <lua.hpp>\n#include <luaportal/luaportal.h>\n";
+        if (Thunks == CodeGenerator::ThunkMode::Shared)
         {
-            return;
+            ss << "#include <lab/Thunk.h>\n";
         }
-        else 
+        else if (Index == CodeGenerator::IndexMode::Hash)
         {
-            RegistedFiles.insert(File);
-            UnregistedFiles.erase(File);
+            ss << "#include <lab/Dispatch.h>\n";
         }
-
-        for (auto& IncludeFileName : File->IncludeFiles)
+        else if (IsDirect())
         {
-            std::shared_ptr<HeaderFile> RegistFirstFile;
-            if ((!IsRegisted(IncludeFileName)) && IsUnregisted(IncludeFileName, RegistFirstFile))
-            {
-                GenerateFile(RegistFirstFile);
-            }
+            ss << "#include <lab/Direct.h>\n";
         }
-
-        if (isEmptyFile(File))
+        if (Data == CodeGenerator::DataMode::Offset)
         {
-            return;
+            ss << "#include <lab/Field.h>\n";
         }
-
-        ssInclude << "#include \"" << File->Name << "\"" << std::endl;
-
-        for (auto& Node : File->Nodes)
+        if (Pointers == CodeGenerator::PointerMode::Cached)
         {
-            std::list<std::string> NamespaceStack;
-            if (GenerateNamespace(Node, NamespaceStack) 
-                && GenerateClass(Node, NamespaceStack)
-                && GenerateEnum(Node, NamespaceStack)
-                && GenerateFunction(Node, NamespaceStack)
-                )
-            {
-                std::cerr << "Invalid Node:" << Node->Name << std::endl;
-            }
+            ss << "#include <lab/Identity.h>\n";
         }
-    }
-
-    bool GenerateNamespace(const std::shared_ptr<ContentNode>& Node, std::list<std::string>& NamespaceStack) 
-    {
-        auto NSNode = dynamic_cast<CxxNamespace*>(Node.get());
-        if (NSNode == nullptr)
+        if (IsDirect() && !ValueClasses.empty())
         {
-            return true;
+            ss << "#include <lab/Value.h>\n";
         }
-
-        NamespaceStack.push_back(NSNode->Name);
-
-        if (NSNode->bShouldExport)
+        if (Enums == CodeGenerator::EnumMode::Sized)
         {
-            ssNormal << "\t.BeginNamespace(\"" << GetExportName(Node) << "\")\n";
+            ss << "#include <lab/Enum.h>\n";
         }
-
-        for (auto& Node : NSNode->Nodes)
+        if (Ffi == CodeGenerator::FfiMode::Shims)
         {
-            if (GenerateNamespace(Node, NamespaceStack)
-                && GenerateClass(Node, NamespaceStack)
-                && GenerateEnum(Node, NamespaceStack)
-                && GenerateFunction(Node, NamespaceStack)
-                )
-            {
-                std::cerr << "Invalid Node:" << Node->Name << std::endl;
-            }
+            ss << "#include <lab/Ffi.h>\n";
         }
-
-        if (NSNode->bShouldExport)
+        bool bProfile = (Profile == CodeGenerator::ProfileMode::Calls);
+        if (bProfile)
         {
-            ssNormal << "\t.EndNamespace()\n";
+            ss << "#include <lab/Profile.h>\n";
         }
-
-        NamespaceStack.pop_back();
-        return false;
-    }
-
-    std::string GetStackedNameSpace(const std::list<std::string>& NamespaceStack)
-    {
-        std::stringstream ss;
-        for (auto& NS: NamespaceStack)
+        bool bFlatten = (Inherit == CodeGenerator::InheritMode::Flatten);
+        if (bFlatten)
         {
-            ss << NS << "::";
+            ss << "#include <lab/Inherit.h>\n";
         }
-        return ss.str();
-    }
-
-    bool GenerateClass(const std::shared_ptr<ContentNode>& Node, std::list<std::string>& NamespaceStack)
-    {
-        auto ClassNode = dynamic_cast<LuaClass*>(Node.get());
-        if (ClassNode == nullptr)
+        bool bLazy = (Register == CodeGenerator::RegisterMode::Lazy);
+        if (bLazy)
         {
-            return true;
+            ss << "#include <lab/Module.h>\n";
         }
-
-        if (ClassNode->ParentClass.empty())
-        {
-            ssNormal << "\t.BeginClass<" << GetStackedNameSpace(NamespaceStack) << ClassNode->Name << ">(\"" << GetExportName(Node) << "\")\n";
-        } 
-        else
+        for (auto Index : FileIndices)
         {
-            ssNormal << "\t.DeriveClass<" << GetStackedNameSpace(NamespaceStack) << ClassNode->Name << "," << ClassNode->ParentClass << ">(\"" << GetExportName(Node) << "\")\n";
+            ss << Fragments[Index].ssInclude.str();
         }
-
-        NamespaceStack.push_back(ClassNode->Name);
-        
-        for (auto& Node : ClassNode->Nodes)
+        ss << std::endl;
+        for (auto Index : FileIndices)
         {
-            if (GenerateData(Node, NamespaceStack)
-                && GenerateEnum(Node, NamespaceStack)
-                && GenerateFunction(Node, NamespaceStack)
-                && GenerateConstructor(Node, NamespaceStack)
-                )
-            {
-                std::cerr << "Invalid Node:" << Node->Name << std::endl;
-            }
+            ComposeProfile(ss, Fragments[Index]);
+            ss << Fragments[Index].ssDirect.str();
         }
-
-        NamespaceStack.pop_back();
-        ssNormal << "\t.EndClass()\n";
-        return false;
-    }
-
-    bool GenerateConstructor(const std::shared_ptr<ContentNode>& Node, std::list<std::string>& NamespaceStack)
-    {
-        auto ConstructorNode = dynamic_cast<CppClassConstructor*>(Node.get());
-        if (ConstructorNode == nullptr)
+        std::vector<std::string> ModuleNames;
+        if (bLazy)
         {
-            return true;
+            ModuleNames = ComposeModules(ss, FileIndices);
         }
-        ssNormal << "\t.Def(luaportal::Constructor<" << ConstructorNode->Params << ">())\n";
-        return false;
-    }
-
-    bool GenerateFunction(const std::shared_ptr<ContentNode>& Node, std::list<std::string>& NamespaceStack)
-    {
-        auto FunctionNode = dynamic_cast<LuaFunction*>(Node.get());
-        if (FunctionNode == nullptr)
+        ss << "void RegisterAPIs" << Suffix << "(luaportal::LuaState& LOL) \n{\n";
+        if (bLazy)
         {
-            return true;
+            for (auto& Name : ModuleNames)
+            {
+                ss << "\tlab::AddModule(LOL, \"" << Name << "\", &" << MakeLoaderName(Name) << ");\n";
+            }
+            ComposeRequiredModules(ss, FileIndices, "", "lab::portal::GetState(LOL)");
         }
-        std::string COrEmptyString = FunctionNode->IsCFunction ? "C" : "";
-        switch (FunctionNode->Type)
-        {
-        case FunctionType::Common:
+        ss << "\tLOL.GlobalContext()\n";
+        for (auto Index : FileIndices)
         {
-            ssNormal << "\t.Add" << COrEmptyString << "Function(\"" << GetExportName(Node) << "\", &" << GetStackedNameSpace(NamespaceStack) << FunctionNode->Name << ")\n";
-            break;
+            ss << Fragments[Index].ssNormal.str();
         }
-        case FunctionType::Static:
+        for (auto Index : FileIndices)
         {
-            ssNormal << "\t.AddStatic" << COrEmptyString << "Function(\"" << GetExportName(Node) << "\", &" << GetStackedNameSpace(NamespaceStack) << FunctionNode->Name << ")\n";
-            break;
+            ss << Fragments[Index].ssGlobal.str();
         }
-        case FunctionType::Global:
+        ss << "\t;\n";
+        ComposeThunks(ss, FileIndices, &Fragment::ssThunk, bProfile ? "\tlab::BindProfile(L);\n" : "");
+        ss << "}\n\n"
+            << "void UnregisterStaticLuaProperties" << Suffix << "() \n{\n";
+        for (auto Index : FileIndices)
         {
-            ssGlobal << "\t.Add" << COrEmptyString << "Function(\"" << GetExportName(Node) << "\", &" << GetStackedNameSpace(NamespaceStack) << FunctionNode->Name << ")\n";
-            break;
+            ss << Fragments[Index].ssAutoNull.str();
         }
-        case FunctionType::Property:
+        ss << "}\n";
+        if (!PreviousFiles.empty())
         {
-            auto StackedNameSpace = GetStackedNameSpace(NamespaceStack);
-            if (FunctionNode->SetterName.empty())
+            ss << "\nvoid RegisterAPIsDelta" << Suffix << "(luaportal::LuaState& LOL) \n{\n";
+            if (Suffix.empty())
             {
-                ssNormal << "\t.AddProperty(\"" << GetExportName(Node) << "\", &" << StackedNameSpace << FunctionNode->Name << ")\n";
+                ComposeRemovedFiles(ss);
             }
-            else
+            for (auto Index : FileIndices)
             {
-                ssNormal << "\t.AddProperty(\"" << GetExportName(Node) << "\", &" << StackedNameSpace << FunctionNode->Name << ", &"<< StackedNameSpace << FunctionNode->SetterName << ")\n";
+                ss << Fragments[Index].ssRemoved.str();
             }
-            break;
-        }
-        default:
-            break;
+            if (bLazy)
+            {
+                // The delta patches what the previous registration built, so nothing may still be pending
+                ss << "\tlab::LoadModules(lab::portal::GetState(LOL));\n";
+            }
+            ss << "\tLOL.GlobalContext()\n";
+            for (auto Index : FileIndices)
+            {
+                ss << Fragments[Index].ssDelta.str();
+            }
+            for (auto Index : FileIndices)
+            {
+                ss << Fragments[Index].ssDeltaGlobal.str();
+            }
+            ss << "\t;\n";
+            ComposeThunks(ss, FileIndices, &Fragment::ssDeltaThunk);
+            if (bFlatten)
+            {
+                // Derived classes still hold what their parents had before the delta
+                ss << "\tlab::RefreshFlattened(lab::portal::GetState(LOL));\n";
+            }
+            ss << "}\n";
         }
-
-        return false;
+        return ss.str();
     }
 
-    bool GenerateEnum(const std::shared_ptr<ContentNode>& Node, std::list<std::string>& NamespaceStack)
+    // Writes one loader per lazy namespace of the given files and returns their names in order of appearance
+    std::vector<std::string> ComposeModules(std::ostream& ss, const std::vector<size_t>& FileIndices)
     {
-        auto EnumNode = dynamic_cast<LuaEnum*>(Node.get());
-        if (EnumNode == nullptr)
+        std::vector<std::string> Names;
+        std::unordered_map<std::string, bool> Seen;
+        for (auto Index : FileIndices)
         {
-            return true;
+            for (auto& Item : Fragments[Index].Modules)
+            {
+                if (!Seen[Item.Name])
+                {
+                    Seen[Item.Name] = true;
+                    Names.push_back(Item.Name);
+                }
+            }
         }
-        auto StackedNameSpace = GetStackedNameSpace(NamespaceStack);
-        ssNormal << "\t.BeginEnum<" << StackedNameSpace << EnumNode->Name << ">(\"" << GetExportName(Node) << "\")\n";
-        for (auto& EnumKey : EnumNode->Keys)
+        for (auto& Name : Names)
         {
-            ssNormal << "\t.AddEnumValue(\"" << EnumKey << "\", " << StackedNameSpace << EnumNode->Name << "::" << EnumKey << ")\n";
+            ss << "static void " << MakeLoaderName(Name) << "(luaportal::LuaState& LOL, lua_State* L) \n{\n";
+            ComposeRequiredModules(ss, FileIndices, Name, "L");
+            ss << "\tLOL.GlobalContext()\n";
+            std::stringstream Thunk;
+            for (auto Index : FileIndices)
+            {
+                for (auto& Item : Fragments[Index].Modules)
+                {
+                    if (Item.Name == Name)
+                    {
+                        ss << Item.Normal;
+                        Thunk << Item.Thunk;
+                    }
+                }
+            }
+            ss << "\t;\n" << Thunk.str() << "}\n\n";
         }
-        ssNormal << "\t.EndEnum()\n";
-        return false;
+        return Names;
     }
 
-    bool GenerateData(const std::shared_ptr<ContentNode>& Node, std::list<std::string>& NamespaceStack)
+    // Loads the lazy namespaces holding the bases of classes the code of Module derives, "" being the eager part
+    void ComposeRequiredModules(std::ostream& ss, const std::vector<size_t>& FileIndices, const std::string& Module, const char* State)
     {
-        auto DataNode = dynamic_cast<LuaData*>(Node.get());
-        if (DataNode == nullptr)
+        std::vector<std::string> Required;
+        for (auto Index : FileIndices)
         {
-            return true;
+            for (auto& Base : Fragments[Index].Bases)
+            {
+                if (Base.Module != Module)
+                {
+                    continue;
+                }
+                auto BaseModule = FindClassModule(Base.Scope, Base.Name);
+                if (!BaseModule.empty() && BaseModule != Module && std::find(Required.begin(), Required.end(), BaseModule) == Required.end())
+                {
+                    Required.push_back(BaseModule);
+                }
+            }
         }
-        auto StackedNameSpace = GetStackedNameSpace(NamespaceStack);
-        ssNormal << (DataNode->IsStatic ? "\t.AddStaticData(\"" : "\t.AddData(\"") << GetExportName(Node) << "\", &" << StackedNameSpace << DataNode->Name << (DataNode->Writeable ? ", true" : ", false") << ")\n";
-        if (DataNode->IsStatic && DataNode->IsAutoNull)
+        for (auto& Name : Required)
         {
-            ssAutoNull << "\t" << StackedNameSpace << DataNode->Name << " = nullptr;\n";
+            ss << "\tlab::RequireModule(" << State << ", \"" << Name << "\");\n";
         }
-
-        return false;
     }
 
-    bool IsRegisted(const std::string& FileName)
+    // Looks Name up the way C++ does from inside Scope, from the innermost enclosing scope outwards
+    std::string FindClassModule(const std::string& Scope, const std::string& Name)
     {
-        for (auto& file : RegistedFiles)
+        auto Qualified = Name.compare(0, 2, "::") == 0 ? Name.substr(2) : Name;
+        auto Prefix = Scope;
+        while (true)
         {
-            if (file->Name.find(FileName) != std::string::npos)
+            auto itr = ClassModule.find(Prefix + Qualified);
+            if (itr != ClassModule.end())
             {
-                return true;
+                return itr->second;
+            }
+            if (Prefix.empty())
+            {
+                return std::string();
             }
+            auto Pos = Prefix.rfind("::", Prefix.size() - 3);
+            Prefix.resize(Pos == std::string::npos ? 0 : Pos + 2);
         }
-        return false;
     }
 
-    bool IsUnregisted(const std::string& FileName, std::shared_ptr<HeaderFile>& FilePtr)
+    static std::string MakeLoaderName(const std::string& Module)
     {
-        for (auto& file : UnregistedFiles)
+        auto Name = "LoadModule_" + Module;
+        for (auto& c : Name)
         {
-            if (file->Name.find(FileName) != std::string::npos)
+            if (!isalnum(static_cast<unsigned char>(c)))
             {
-                FilePtr = file;
-                return true;
+                c = '_';
             }
         }
-        return false;
+        return Name;
     }
 
-    void ParseDocument(const Document& document)
+    void ComposeThunks(std::ostream& ss, const std::vector<size_t>& FileIndices, std::stringstream Fragment::* Stream, const std::string& Last = std::string())
     {
-        for (SizeType i = 0; i < document.Size(); ++i)
+        std::stringstream Lines;
+        for (auto Index : FileIndices)
+        {
+            Lines << (Fragments[Index].*Stream).str();
+        }
+        Lines << Last;
+        auto Text = Lines.str();
+        if (!Text.empty())
         {
-            auto& v = document[i];
-            auto& file = ParseFile(v);
-            Files.push_back(file);
-            UnregistedFiles.insert(file);
+            ss << "\tlua_State* L = lab::portal::GetState(LOL);\n" << Text;
         }
-        Files.sort();
     }
 
-    std::shared_ptr<HeaderFile> ParseFile(const Document::ValueType& FileObject)
+    // The profile array the thunks of a file count into, and the block listing it in lab/Profile.h once the binary loads
+    static void ComposeProfile(std::ostream& ss, const Fragment& Item)
     {
-        std::shared_ptr<HeaderFile> File = std::make_shared<HeaderFile>();
-        File->Name = FileObject["file"].GetString();
-        CurrentFile = File->Name;
-        auto& ContentArray = FileObject["content"];
-        for (SizeType i = 0; i < ContentArray.Size(); ++i)
+        if (Item.Profiled.empty())
         {
-            auto& Unit = ContentArray[i];
-            std::string type = Unit["type"].GetString();
-            if (type == "class")
-            {
-                File->Nodes.push_back(ParseClass(Unit));
-            }
-            else if (type == "function")
-            {
-                File->Nodes.push_back(ParseFunction(Unit));
-            }
-            else if (type == "include")
-            {
-                File->IncludeFiles.push_back(Unit["file"].GetString());
-            }
-            else if (type == "enum")
-            {
-                File->Nodes.push_back(ParseEnum(Unit));
-            }
-            else if (type == "namespace")
-            {
-                File->Nodes.push_back(ParseNamespace(Unit));
-            }
+            return;
+        }
+        auto Count = std::to_string(Item.Profiled.size());
+        ss << "static lab::BindingStats Profile_" << Item.FilePrefix << "[" << Count << "];\n"
+            << "static const char* const ProfileNames_" << Item.FilePrefix << "[] = {\n";
+        for (auto& Name : Item.Profiled)
+        {
+            ss << "\t\"" << Name << "\",\n";
         }
-        File->IncludeFiles.sort();
-        return File;
+        ss << "};\n"
+            << "static lab::ProfileBlock ProfileBlock_" << Item.FilePrefix << "(ProfileNames_" << Item.FilePrefix << ", Profile_" << Item.FilePrefix << ", " << Count << ");\n\n";
     }
 
-    void TryGetComment(const Document::ValueType& Object, std::string& Comment) 
+    void ComposeRemovedFiles(std::ostream& ss)
     {
-        auto itr = Object.FindMember("comment");
-        if (itr != Object.MemberEnd())
+        for (auto& Name : RemovedFiles)
         {
-            Comment = itr->value.GetString();
+            ss << "\t// removed " << Name << ", its bindings stay registered until restart\n";
         }
     }
 
-    std::shared_ptr<CxxNamespace> ParseNamespace(const Document::ValueType& NamespaceObject)
+    bool IsEmptyNode(const Node& Item)
     {
-        std::shared_ptr<CxxNamespace> Namespace = std::make_shared<CxxNamespace>();
-        Namespace->Name = NamespaceObject["name"].GetString();
-        Namespace->bShouldExport = NamespaceObject.HasMember("macro");
-        TryGetExportName(NamespaceObject, Namespace->ExportName);
-        auto& NamespaceMembers = NamespaceObject["members"];
-        for (SizeType i = 0; i < NamespaceMembers.Size(); ++i)
+        if (Item.Kind != NodeKind::Namespace)
         {
-            auto& Unit = NamespaceMembers[i];
-            std::string type = Unit["type"].GetString();
-            if (type == "class")
-            {
-                Namespace->Nodes.push_back(ParseClass(Unit));
-            }
-            else if (type == "function")
-            {
-                Namespace->Nodes.push_back(ParseFunction(Unit));
-            }
-            else if (type == "enum")
+            return false;
+        }
+        for (auto& Child : Item.Children)
+        {
+            if (!IsEmptyNode(Child))
             {
-                Namespace->Nodes.push_back(ParseEnum(Unit));
+                return false;
             }
         }
-        return Namespace;
+        return true;
     }
 
-    void TryGetExportName(const Document::ValueType& Object, std::string& Name)
+    bool isEmptyFile(const HeaderFile& File)
     {
-        auto itrMeta = Object.FindMember("meta");
-        if (itrMeta != Object.MemberEnd())
+        for (auto& Item : File.Nodes)
         {
-            auto itr = itrMeta->value.FindMember("name");
-            if (itr != itrMeta->value.MemberEnd())
+            if (!IsEmptyNode(Item))
             {
-                Name = itr->value.GetString();
+                return false;
             }
         }
-        
+        return true;
     }
 
-    std::shared_ptr<LuaEnum> ParseEnum(const Document::ValueType& EnumObject)
+    void GenerateFile(const HeaderFile& File, Fragment& Out)
     {
-        std::shared_ptr<LuaEnum> Enum = std::make_shared<LuaEnum>();
-        Enum->Name = EnumObject["name"].GetString();
-        TryGetExportName(EnumObject, Enum->ExportName);
-        auto& EnumMembers = EnumObject["members"];
-        for (SizeType i = 0; i < EnumMembers.Size(); ++i)
+        Out.FilePrefix = MakeShardName(File.Name);
+        if (isEmptyFile(File))
         {
-            Enum->Keys.push_back(EnumMembers[i]["key"].GetString());
+            return;
         }
-        TryGetComment(EnumObject, Enum->Comment);
-        return Enum;
-    }
 
-    std::shared_ptr<LuaClass> ParseClass(const Document::ValueType& ClassObject)
-    {
-        std::shared_ptr<LuaClass> Class = std::make_shared<LuaClass>();
-        Class->Name = ClassObject["name"].GetString();
-        TryGetExportName(ClassObject, Class->ExportName);
-        if (!ClassObject["meta"].HasMember("noinherit"))
-        {
-            GetClassParent(ClassObject, Class->ParentClass);
-        }
+        Out.ssInclude << "#include \"" << File.Name << "\"" << std::endl;
 
-        auto& ClassMembers = ClassObject["members"];
-        for (SizeType i = 0; i < ClassMembers.Size(); ++i)
+        // Qualified name prefix of the current scope, "ns::Class::", grown and shrunk as scopes are entered
+        std::string Scope;
+        for (auto& Item : File.Nodes)
         {
-            auto& Unit = ClassMembers[i];
-            std::string type = Unit["type"].GetString();
-            if (type == "function")
-            {
-                Class->Nodes.push_back(ParseFunction(Unit));
-            }
-            else if (type == "property")
-            {
-                Class->Nodes.push_back(ParseData(Unit));
-            }
-            else if (type == "enum")
-            {
-                Class->Nodes.push_back(ParseEnum(Unit));
-            }
-            else if (type == "constructor")
-            {
-                Class->Nodes.push_back(ParseConstructor(Unit));
-            }
+            GenerateNode(Item, Scope, Out);
         }
-        TryGetComment(ClassObject, Class->Comment);
-        return Class;
     }
 
-    std::string GetParamsArrayDesc(const Document::ValueType& Params, bool OnlyType)
+    void GenerateNode(const Node& Item, std::string& Scope, Fragment& Out)
     {
-        auto ParamsSize = Params.Size();
-        std::string ParamsString = "";
-        for (decltype(ParamsSize) i = 0; i < ParamsSize; ++i)
+        switch (Item.Kind)
         {
-            auto& Param = OnlyType ? Params[i] : Params[i]["type"];
-            ParamsString.append(GetParamTypeDesc(Param));
-            if (i < ParamsSize - 1)
-            {
-                ParamsString.append(", ");
-            }
+        case NodeKind::Namespace:
+            GenerateNamespace(Item, Scope, Out);
+            break;
+        case NodeKind::Class:
+            GenerateClass(Item, Scope, Out);
+            break;
+        case NodeKind::Enum:
+            GenerateEnum(Item, Scope, Out);
+            break;
+        case NodeKind::Function:
+            GenerateFunction(Item, Scope, Out);
+            break;
+        case NodeKind::Data:
+            GenerateData(Item, Scope, Out);
+            break;
+        case NodeKind::Constructor:
+            GenerateConstructor(Item, Scope, Out);
+            break;
+        default:
+            std::cerr << "Invalid Node:" << Item.Name << std::endl;
+            break;
         }
-        return ParamsString;
     }
 
-    std::string GetParamTypeDesc(const Document::ValueType& TypeObject)
+    void GenerateChildren(const Node& Item, std::string& Scope, Fragment& Out)
     {
-        std::string Desc = "";
-        auto ConstItr = TypeObject.FindMember("const");
-        std::string TypeType = TypeObject["type"].GetString();
-        bool IsConst = (ConstItr != TypeObject.MemberEnd() && ConstItr->value.GetBool());
-        if (TypeType == "pointer")
+        auto ScopeSize = Scope.size();
+        auto LuaPathSize = Out.LuaPath.size();
+        auto OuterClass = Out.Class;
+        EnterScope(Item, Scope, Out);
+        for (auto& Child : Item.Children)
         {
-            Desc.append(GetParamTypeDesc(TypeObject["baseType"]).append("*"));
-
-            if (IsConst)
-            {
-                Desc.append(" const");
-            }
-            IsConst = false;
-        }
-        else if (TypeType == "literal")
-        {
-            Desc.append(TypeObject["name"].GetString());
+            GenerateNode(Child, Scope, Out);
         }
-        else if (TypeType == "reference")
+        Scope.resize(ScopeSize);
+        Out.LuaPath.resize(LuaPathSize);
+        Out.Class = OuterClass;
+    }
+
+    static void EnterScope(const Node& Item, std::string& Scope, Fragment& Out)
+    {
+        Scope.append(Item.Name).append("::");
+        if (Item.Kind == NodeKind::Class)
         {
-            Desc.append(GetParamTypeDesc(TypeObject["baseType"]).append("&"));
+            Out.Class = &Item;
         }
-        else if (TypeType == "lreference")
+        else if (Item.ShouldExport)
         {
-            Desc.append(GetParamTypeDesc(TypeObject["baseType"]).append("&&"));
+            Out.LuaPath.append(Out.LuaPath.empty() ? "" : ".").append(Item.GetExportName());
         }
-        else if (TypeType == "template")
+    }
+
+    void GenerateNamespace(const Node& Item, std::string& Scope, Fragment& Out)
+    {
+        if (Register == CodeGenerator::RegisterMode::Lazy && Item.ShouldExport && Out.LuaPath.empty())
         {
-            Desc.append(TypeObject["name"].GetString()).append("<").append(GetParamsArrayDesc(TypeObject["parameters"], true)).append(">");
+            GenerateModule(Item, Scope, Out);
+            return;
         }
-        else if (TypeType == "function")
+
+        if (Item.ShouldExport)
         {
-            Desc.append(GetParamTypeDesc(TypeObject["returnType"])).append("(").append(GetParamsArrayDesc(TypeObject["parameters"], false)).append(")");
+            Out.ssNormal << "\t.BeginNamespace(\"" << Item.GetExportName() << "\")\n";
         }
 
-        if (IsConst)
+        GenerateChildren(Item, Scope, Out);
+
+        if (Item.ShouldExport)
         {
-            Desc.insert(0, "const ");
+            Out.ssNormal << "\t.EndNamespace()\n";
         }
-
-        return Desc;
     }
 
-    std::shared_ptr<CppClassConstructor> ParseConstructor(const Document::ValueType& ConstructorObject)
+    // Generates a top level namespace apart, ComposeModules turns it into a loader
+    void GenerateModule(const Node& Item, std::string& Scope, Fragment& Out)
     {
-        std::shared_ptr<CppClassConstructor> Constructor = std::make_shared<CppClassConstructor>();
-        Constructor->Params = GetParamsArrayDesc(ConstructorObject["parameters"], false);
+        Fragment Temp;
+        Temp.FilePrefix = Out.FilePrefix;
+        Temp.ModuleName = Item.GetExportName();
+        Temp.GlobalThunk = &Out.ssThunk;
+        // The thunks land in the same file, so they keep counting slots of its profile array
+        Temp.Profiled.swap(Out.Profiled);
+        Temp.ssNormal << "\t.BeginNamespace(\"" << Item.GetExportName() << "\")\n";
+        GenerateChildren(Item, Scope, Temp);
+        Out.Profiled.swap(Temp.Profiled);
+        Temp.ssNormal << "\t.EndNamespace()\n";
+
+        Out.Modules.push_back({ Temp.ModuleName, Temp.ssNormal.str(), Temp.ssThunk.str() });
+        Out.ssDirect << Temp.ssDirect.str();
+        Out.ssGlobal << Temp.ssGlobal.str();
+        Out.ssAutoNull << Temp.ssAutoNull.str();
+        Out.ssFfiCdef << Temp.ssFfiCdef.str();
+        Out.ssFfiLua << Temp.ssFfiLua.str();
+        Out.ThunkKeys.insert(Out.ThunkKeys.end(), Temp.ThunkKeys.begin(), Temp.ThunkKeys.end());
+        Out.ClassModules.insert(Out.ClassModules.end(), Temp.ClassModules.begin(), Temp.ClassModules.end());
+        Out.Bases.insert(Out.Bases.end(), Temp.Bases.begin(), Temp.Bases.end());
+    }
 
-        TryGetComment(ConstructorObject, Constructor->Comment);
-        return Constructor;
+    static void BeginClass(const Node& Item, const std::string& Scope, std::ostream& Stream)
+    {
+        if (Item.Detail.empty())
+        {
+            Stream << "\t.BeginClass<" << Scope << Item.Name << ">(\"" << Item.GetExportName() << "\")\n";
+        } 
+        else
+        {
+            Stream << "\t.DeriveClass<" << Scope << Item.Name << "," << Item.Detail << ">(\"" << Item.GetExportName() << "\")\n";
+        }
     }
 
-    std::shared_ptr<LuaFunction> ParseFunction(const Document::ValueType& FunctionObject)
+    void GenerateClass(const Node& Item, std::string& Scope, Fragment& Out)
     {
-        std::shared_ptr<LuaFunction> Function = std::make_shared<LuaFunction>();
-        Function->Name = FunctionObject["name"].GetString();
-        TryGetExportName(FunctionObject, Function->ExportName);
-        Function->Type = FunctionType::Common;
-        Function->IsCFunction = false;
-        bool IsMemberFunc = false;
-        auto itr = FunctionObject.FindMember("access");
-        if (itr != FunctionObject.MemberEnd())
+        if (IsValueClass(&Item))
+        {
+            GenerateValueClass(Item, Scope, Out);
+            return;
+        }
+        BeginClass(Item, Scope, Out.ssNormal);
+        if (Register == CodeGenerator::RegisterMode::Lazy)
         {
-            if (std::string(itr->value.GetString()) != "public")
+            Out.ClassModules.emplace_back(Scope + Item.Name, Out.ModuleName);
+            if (!Item.Detail.empty())
             {
-                std::stringstream ss;
-                ss << "Function :" << Function->Name << "must be public, Line: " << FunctionObject["line"].GetInt();
-                throw ss.str();
+                Out.Bases.push_back({ Out.ModuleName, Scope, Item.Detail });
             }
-            IsMemberFunc = true;
         }
-        bool IsStatic = false;
-        itr = FunctionObject.FindMember("static");
-        if (itr != FunctionObject.MemberEnd())
+
+        std::stringstream ClassFields;
+        auto OuterFields = Out.Fields;
+        // A derived class is only standard layout when a single class of its hierarchy has data, which the ast does not
+        // tell, and a class with a virtual method never is, so both keep their data on the chain. The classes the ast
+        // cannot rule out, private data or unexported virtuals, fall back to per member accessors in lab::MakeField.
+        if (Data == CodeGenerator::DataMode::Offset && Item.Detail.empty() && !HasVirtualMethod(Item))
+        {
+            Out.Fields = &ClassFields;
+        }
+        Fragment::FunctionTables ClassTables;
+        auto OuterTables = Out.Tables;
+        Out.Tables = (Thunks == CodeGenerator::ThunkMode::Table) ? &ClassTables : nullptr;
+        GenerateChildren(Item, Scope, Out);
+        Out.Fields = OuterFields;
+        Out.Tables = OuterTables;
+
+        Out.ssNormal << "\t.EndClass()\n";
+
+        auto ClassName = Scope + Item.Name;
+        auto Entries = ClassFields.str();
+        if (!Entries.empty())
+        {
+            Out.ssThunk << "\t{\n\t\tstatic const lab::Field Fields[] = {\n" << Entries << "\t\t};\n"
+                << "\t\tlab::BindFields<" << ClassName << ">(L, Fields);\n\t}\n";
+        }
+
+        std::stringstream Install;
+        GenerateFunctionTable(Install, ClassName, "Methods", ClassTables.Methods, { "Methods" });
+        GenerateFunctionTable(Install, ClassName, "ConstMethods", ClassTables.ConstMethods, { "Methods", "ConstMethods" });
+        GenerateFunctionTable(Install, ClassName, "Statics", ClassTables.Statics, { "Statics" });
+        GenerateFunctionTable(Install, ClassName, "Getters", ClassTables.Getters, { "Getters" });
+        GenerateFunctionTable(Install, ClassName, "ConstGetters", ClassTables.ConstGetters, { "Getters", "ConstGetters" });
+        GenerateFunctionTable(Install, ClassName, "Setters", ClassTables.Setters, { "Setters" });
+        if (!ClassTables.Index.empty())
+        {
+            GenerateIndexTable(Install, "Table", ClassTables.Index, false);
+            GenerateIndexTable(Install, "ConstTable", ClassTables.Index, true);
+            Install << "\t\tlab::BindIndex<" << ClassName << ">(L, &Table, &ConstTable);\n";
+        }
+        auto Tables = Install.str();
+        if (!Tables.empty())
         {
-            IsStatic = itr->value.GetBool();
+            Out.ssThunk << "\t{\n" << Tables << "\t}\n";
         }
 
-        if (IsStatic)
+        // After everything the class binds itself, so its own members win over inherited ones
+        if (Inherit == CodeGenerator::InheritMode::Flatten && !Item.Detail.empty())
         {
-            auto& FunctionMeta = FunctionObject["meta"];
-            Function->Type = (FunctionMeta.HasMember("global"))
-                ? FunctionType::Global
-                : (IsMemberFunc 
-                    ? FunctionType::Static 
-                    : FunctionType::Common);
+            Out.ssThunk << "\tlab::FlattenClass<" << ClassName << ", " << Item.Detail << ">(L);\n";
         }
-        std::string FunctionObjectMacro = FunctionObject["macro"].GetString();
-        if (FunctionObjectMacro == FunctionPropertyMacro)
+    }
+
+    // A value class never reaches luaportal: every member is a thunk and the class is described by one lab::ValueClass
+    void GenerateValueClass(const Node& Item, std::string& Scope, Fragment& Out)
+    {
+        Fragment::FunctionTables ClassTables;
+        auto OuterTables = Out.Tables;
+        auto OuterFields = Out.Fields;
+        Out.Tables = &ClassTables;
+        Out.Fields = nullptr;
+        GenerateChildren(Item, Scope, Out);
+        Out.Tables = OuterTables;
+        Out.Fields = OuterFields;
+
+        std::stringstream Install;
+        auto Table = [&Install](const std::string& Name, std::initializer_list<const std::stringstream*> Streams)
         {
-            if (IsStatic || !IsMemberFunc)
+            std::string Text;
+            for (auto Stream : Streams)
             {
-                std::stringstream ss;
-                ss << "Property :" << Function->Name << "must not be static and should be member func, Line: " << FunctionObject["line"].GetInt();
-                throw ss.str();
+                Text += Stream->str();
             }
-            Function->Type = FunctionType::Property;
-            auto& FunctionMeta = FunctionObject["meta"];
-            auto itrSetter = FunctionMeta.FindMember("setter");
-            if (itrSetter != FunctionMeta.MemberEnd())
+            if (Text.empty())
             {
-                Function->SetterName = itrSetter->value.GetString();
+                return std::string("nullptr");
             }
-        } 
-        else if (FunctionObjectMacro == CFunctionMacro)
+            Install << "\t\tstatic const luaL_Reg " << Name << "[] = {\n" << Text << "\t\t\t{ nullptr, nullptr }\n\t\t};\n";
+            return Name;
+        };
+        auto Methods = Table("Methods", { &ClassTables.Methods, &ClassTables.ConstMethods });
+        auto Getters = Table("Getters", { &ClassTables.Getters, &ClassTables.ConstGetters });
+        auto Setters = Table("Setters", { &ClassTables.Setters });
+        auto Statics = Table("Statics", { &ClassTables.Statics });
+        std::string Fields = "nullptr";
+        if (!ClassTables.Fields.empty())
         {
-            Function->IsCFunction = true;
+            Install << "\t\tstatic const char* const Fields[] = { ";
+            for (auto& Name : ClassTables.Fields)
+            {
+                Install << "\"" << Name << "\", ";
+            }
+            Install << "nullptr };\n";
+            Fields = "Fields";
         }
-        TryGetComment(FunctionObject, Function->Comment);
-        return Function;
+        auto Construct = ClassTables.Constructor.empty() ? std::string("nullptr") : "&" + ClassTables.Constructor;
+        Install << "\t\tstatic const lab::ValueClass Class = { \"" << Item.GetExportName() << "\", " << Methods << ", " << Getters << ", "
+            << Setters << ", " << Statics << ", " << Fields << ", " << Construct << " };\n"
+            << "\t\tlab::BindValue<" << Scope << Item.Name << ">(L, \"" << Out.LuaPath << "\", Class);\n";
+        Out.ssThunk << "\t{\n" << Install.str() << "\t}\n";
     }
 
-    std::shared_ptr<LuaData> ParseData(const Document::ValueType& DataObject)
+    // Must compute exactly what lab::detail::HashKey of lab/Dispatch.h computes
+    static uint32_t HashKey(const std::string& Key, uint32_t Seed, bool Full)
     {
-        std::shared_ptr<LuaData> Data = std::make_shared<LuaData>();
-        Data->Name = DataObject["name"].GetString();
-        TryGetExportName(DataObject, Data->ExportName);
-        Data->Writeable = !DataObject["meta"].HasMember("readonly");
-        Data->IsStatic = DataObject["dataType"].HasMember("static");
-        Data->IsAutoNull = (DataObject["macro"].GetString() == AutoNullMacro);
-        TryGetComment(DataObject, Data->Comment);
-        return Data;
+        uint32_t Hash = Seed;
+        auto Mix = [&Hash](unsigned char c) {
+            Hash ^= c;
+            Hash *= 16777619u;
+        };
+        if (Full)
+        {
+            for (auto c : Key)
+            {
+                Mix(static_cast<unsigned char>(c));
+            }
+        }
+        else if (!Key.empty())
+        {
+            Mix(static_cast<unsigned char>(Key[0]));
+            Mix(static_cast<unsigned char>(Key[Key.size() / 2]));
+            Mix(static_cast<unsigned char>(Key.back()));
+        }
+        Mix(static_cast<unsigned char>(Key.size()));
+        Hash ^= Hash >> 15;
+        Hash *= 0x2c1b3c6du;
+        Hash ^= Hash >> 12;
+        return Hash;
     }
 
-    bool GetClassParent(const Document::ValueType& ClassObject, std::string& OutParentClassName)
+    // Static lab::IndexTable named Table over the members, only those reachable from const objects when Const is set.
+    // Tries hashing a few characters before whole names, and as few slots as possible before more.
+    static void GenerateIndexTable(std::stringstream& ss, const std::string& Table, const std::vector<Fragment::IndexMember>& Members, bool Const)
     {
-        auto itr = ClassObject.FindMember("parents");
-        if (itr == ClassObject.MemberEnd())
+        std::vector<const Fragment::IndexMember*> Keys;
+        std::unordered_set<std::string> Seen;
+        for (auto& Member : Members)
         {
-            return false;
+            if ((!Const || Member.IsConst) && Seen.insert(Member.Name).second)
+            {
+                Keys.push_back(&Member);
+            }
         }
-        auto &ParentsArray = itr->value;
-        for (SizeType i = 0; i < ParentsArray.Size(); ++i)
+        uint32_t Size = 1;
+        while (Size < Keys.size())
         {
-            auto& ParentObject = ParentsArray[i];
-            if (std::string(ParentObject["access"].GetString()) != "public")
+            Size *= 2;
+        }
+
+        std::vector<const Fragment::IndexMember*> Slots;
+        auto TrySeed = [&](uint32_t Seed, bool Full)
+        {
+            Slots.assign(Size, nullptr);
+            for (auto Key : Keys)
+            {
+                auto& Slot = Slots[HashKey(Key->Name, Seed, Full) & (Size - 1)];
+                if (Slot)
+                {
+                    return false;
+                }
+                Slot = Key;
+            }
+            return true;
+        };
+        uint32_t Seed = 0;
+        bool Full = false;
+        for (bool Found = false; !Found; )
+        {
+            for (int Pass = 0; Pass < 2 && !Found; ++Pass)
+            {
+                Full = (Pass == 1);
+                for (Seed = 1; Seed <= 1024 && !Found; )
+                {
+                    Found = TrySeed(Seed, Full);
+                    if (!Found)
+                    {
+                        ++Seed;
+                    }
+                }
+            }
+            if (!Found)
+            {
+                Size *= 2;
+            }
+        }
+
+        ss << "\t\tstatic const lab::IndexEntry " << Table << "Entries[] = {\n";
+        for (auto Slot : Slots)
+        {
+            if (!Slot)
+            {
+                ss << "\t\t\t{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },\n";
+                continue;
+            }
+            ss << "\t\t\t{ \"" << Slot->Name << "\", " << Slot->Name.size() << ", lab::IndexKind::" << (Slot->IsMethod ? "Method" : "Property")
+                << ", &" << Slot->Get << ", " << ((Slot->Set.empty() || Const) ? std::string("nullptr") : "&" + Slot->Set) << " },\n";
+        }
+        ss << "\t\t};\n";
+        ss << "\t\tstatic const lab::IndexTable " << Table << " = { " << Seed << "u, " << (Size - 1) << ", " << (Full ? "true" : "false") << ", " << Table << "Entries };\n";
+    }
+
+    // A null terminated luaL_Reg array and the statements installing it into each of the given lab::ClassTable tables
+    static void GenerateFunctionTable(std::ostream& ss, const std::string& ClassName, const char* Name, const std::stringstream& Entries, std::initializer_list<const char*> Targets)
+    {
+        auto Text = Entries.str();
+        if (Text.empty())
+        {
+            return;
+        }
+        ss << "\t\tstatic const luaL_Reg " << Name << "[] = {\n" << Text << "\t\t\t{ nullptr, nullptr }\n\t\t};\n";
+        for (auto Target : Targets)
+        {
+            ss << "\t\tlab::SetFunctions<" << ClassName << ">(L, lab::ClassTable::" << Target << ", " << Name << ");\n";
+        }
+    }
+
+    void GenerateConstructor(const Node& Item, std::string& Scope, Fragment& Out)
+    {
+        if (IsValueClass(Out.Class))
+        {
+            GenerateValueConstructor(Item, Scope, Out);
+            return;
+        }
+        Out.ssNormal << "\t.Def(luaportal::Constructor<" << Item.Detail << ">())\n";
+    }
+
+    // Called through the class table, so the arguments start at 2
+    void GenerateValueConstructor(const Node& Item, std::string& Scope, Fragment& Out)
+    {
+        auto ClassName = Scope.substr(0, Scope.size() - 2);
+        auto ThunkName = "Thunk_" + Out.FilePrefix + "_" + MakeShardName(Scope + Out.Class->Name);
+        std::string Return;
+        std::vector<std::string> Params;
+        SplitSignature("void(" + Item.Detail + ")", Return, Params);
+        std::string Call = ClassName + "(";
+        for (size_t i = 0; i < Params.size(); ++i)
+        {
+            auto Argument = ToArgument(Params[i], Scope, static_cast<int>(i + 2));
+            if (Argument.empty())
+            {
+                Argument = "lab::portal::Get<" + Params[i] + ">(L, " + std::to_string(i + 2) + ")";
+            }
+            Call.append(i ? ", " : "").append(Argument);
+        }
+        Call += ")";
+        Out.ssDirect << BeginThunk(Out, ThunkName, GetBindingPath(Out, false)) << DeclareStrings(Call, "\t")
+            << "\tlab::PushValue(L, " << Call << ");\n\treturn 1;\n}\n\n";
+        Out.Tables->Constructor = ThunkName;
+        Out.ThunkKeys.push_back(ThunkName);
+    }
+
+    // Whether a function takes or returns a value class, which luaportal can not convert
+    bool HasValueType(const Node& Item, const std::string& Scope)
+    {
+        if (ValueClasses.empty())
+        {
+            return false;
+        }
+        std::string Return;
+        std::vector<std::string> Params;
+        SplitSignature(Item.Signature, Return, Params);
+        Params.push_back(Return);
+        for (auto& Type : Params)
+        {
+            if (ClassifyType(Type, Scope).Kind == ValueKind::Value)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // The object a thunk of the innermost class is called on
+    std::string GetSelf(const Fragment& Out, const std::string& ClassName, bool Const, int Index = 1) const
+    {
+        if (IsValueClass(Out.Class))
+        {
+            return "lab::ToValue<" + ClassName + ">(L, " + std::to_string(Index) + ")";
+        }
+        return "lab::portal::GetObject<" + ClassName + ">(L, " + std::to_string(Index) + ", " + (Const ? "true" : "false") + ")";
+    }
+
+    void GenerateFunction(const Node& Item, std::string& Scope, Fragment& Out)
+    {
+        if (Ffi == CodeGenerator::FfiMode::Shims)
+        {
+            GenerateFfiShim(Item, Scope, Out);
+        }
+        // Property thunks go into the class tables, or are bound one by one when luaportal could not convert them
+        bool bThunkProperty = Out.Tables || (IsDirect() && HasValueType(Item, Scope));
+        if (Thunks != CodeGenerator::ThunkMode::Portal && !Item.IsCFunction && (Item.Function != FunctionType::Property || bThunkProperty))
+        {
+            if (Thunks == CodeGenerator::ThunkMode::Shared)
+            {
+                GenerateSharedThunk(Item, Scope, Out);
+            }
+            else
+            {
+                GenerateDirectThunk(Item, Scope, Out);
+            }
+            return;
+        }
+        const char* COrEmptyString = Item.IsCFunction ? "C" : "";
+        switch (Item.Function)
+        {
+        case FunctionType::Common:
+        {
+            Out.ssNormal << "\t.Add" << COrEmptyString << "Function(\"" << Item.GetExportName() << "\", &" << Scope << Item.Name << ")\n";
+            break;
+        }
+        case FunctionType::Static:
+        {
+            Out.ssNormal << "\t.AddStatic" << COrEmptyString << "Function(\"" << Item.GetExportName() << "\", &" << Scope << Item.Name << ")\n";
+            break;
+        }
+        case FunctionType::Global:
+        {
+            Out.ssGlobal << "\t.Add" << COrEmptyString << "Function(\"" << Item.GetExportName() << "\", &" << Scope << Item.Name << ")\n";
+            break;
+        }
+        case FunctionType::Property:
+        {
+            if (Item.Detail.empty())
+            {
+                Out.ssNormal << "\t.AddProperty(\"" << Item.GetExportName() << "\", &" << Scope << Item.Name << ")\n";
+            }
+            else
+            {
+                Out.ssNormal << "\t.AddProperty(\"" << Item.GetExportName() << "\", &" << Scope << Item.Name << ", &"<< Scope << Item.Detail << ")\n";
+            }
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    // Binds the function after the chain through the thunk shared by every function of its type
+    void GenerateSharedThunk(const Node& Item, std::string& Scope, Fragment& Out)
+    {
+        auto ClassName = Scope.substr(0, Scope.size() < 2 ? 0 : Scope.size() - 2);
+        if (Item.Function == FunctionType::Common && Out.Class)
+        {
+            Out.ssThunk << "\tlab::BindMethod<" << ClassName << ">(L, \"" << Item.GetExportName() << "\", &" << Scope << Item.Name << ");\n";
+            Out.ThunkKeys.push_back(ClassName + "::*" + Item.Signature);
+        }
+        else if (Item.Function == FunctionType::Static)
+        {
+            Out.ssThunk << "\tlab::BindStatic<" << ClassName << ">(L, \"" << Item.GetExportName() << "\", &" << Scope << Item.Name << ");\n";
+            Out.ThunkKeys.push_back(Item.Signature);
+        }
+        else
+        {
+            auto Path = (Item.Function == FunctionType::Global) ? std::string() : Out.LuaPath;
+            auto& Stream = (Item.Function == FunctionType::Global && Out.GlobalThunk) ? *Out.GlobalThunk : Out.ssThunk;
+            Stream << "\tlab::BindFunction(L, \"" << Path << "\", \"" << Item.GetExportName() << "\", &" << Scope << Item.Name << ");\n";
+            Out.ThunkKeys.push_back(Item.Signature);
+        }
+    }
+
+    // Defines a lua_CFunction for the function and binds it after the chain, or adds it to the class tables
+    void GenerateDirectThunk(const Node& Item, std::string& Scope, Fragment& Out)
+    {
+        auto ClassName = Scope.substr(0, Scope.size() < 2 ? 0 : Scope.size() - 2);
+        auto ThunkName = "Thunk_" + Out.FilePrefix + "_" + MakeShardName(Scope + Item.Name);
+        if (Item.Function == FunctionType::Property)
+        {
+            GenerateDirectProperty(Item, Scope, Out, ClassName, ThunkName);
+            return;
+        }
+        bool bMethod = (Item.Function == FunctionType::Common && Out.Class);
+        std::string Return;
+        std::vector<std::string> Params;
+        SplitSignature(Item.Signature, Return, Params);
+
+        auto Call = MakeCall(Item, Scope, Params, bMethod, bMethod ? 2 : 1);
+        auto& ss = Out.ssDirect;
+        ss << BeginThunk(Out, ThunkName, GetBindingName(Item, Out, Item.GetExportName())) << DeclareStrings(Call, "\t");
+        if (bMethod)
+        {
+            ss << "\tauto Self = " << GetSelf(Out, ClassName, Item.IsConst) << ";\n";
+        }
+        if (Return == "void")
+        {
+            ss << "\t" << Call << ";\n\treturn 0;\n}\n\n";
+        }
+        else
+        {
+            ss << "\t" << ToPush(Return, Scope, Call) << ";\n\treturn 1;\n}\n\n";
+        }
+
+        if (bMethod && Out.Tables)
+        {
+            (Item.IsConst ? Out.Tables->ConstMethods : Out.Tables->Methods) << TableEntry(Item, ThunkName);
+            AddIndexMember(Out, { Item.GetExportName(), ThunkName, std::string(), true, Item.IsConst });
+        }
+        else if (bMethod)
+        {
+            Out.ssThunk << "\tlab::BindCMethod<" << ClassName << ">(L, \"" << Item.GetExportName() << "\", &" << ThunkName << (Item.IsConst ? ", true" : ", false") << ");\n";
+        }
+        else if (Item.Function == FunctionType::Static && Out.Tables)
+        {
+            Out.Tables->Statics << TableEntry(Item, ThunkName);
+        }
+        else if (Item.Function == FunctionType::Static)
+        {
+            Out.ssThunk << "\tlab::BindCStatic<" << ClassName << ">(L, \"" << Item.GetExportName() << "\", &" << ThunkName << ");\n";
+        }
+        else
+        {
+            auto Path = (Item.Function == FunctionType::Global) ? std::string() : Out.LuaPath;
+            auto& Stream = (Item.Function == FunctionType::Global && Out.GlobalThunk) ? *Out.GlobalThunk : Out.ssThunk;
+            Stream << "\tlab::BindCFunction(L, \"" << Path << "\", \"" << Item.GetExportName() << "\", &" << ThunkName << ");\n";
+        }
+        Out.ThunkKeys.push_back(ThunkName);
+
+        if (Item.IsBatch && (bMethod || !Params.empty()))
+        {
+            GenerateBatchThunk(Item, Scope, Out, ClassName, ThunkName + "_Batch", bMethod, Return, Params);
+        }
+    }
+
+    // C type an FFI shim declares for Type, empty when LuaJIT can not pass it as a plain value. Const references are
+    // passed by value, enums as int, which LuaJIT converts to a number where a 64 bit integer would be boxed.
+    std::string ToFfiType(const std::string& Type, const std::string& Scope, bool bParam)
+    {
+        auto Value = ClassifyType(Type, Scope);
+        if (bParam && Value.Name == "char" && Value.Indirection == '*' && Value.IsConst)
+        {
+            return "const char*";
+        }
+        if (Value.Indirection && !(Value.Indirection == '&' && Value.IsConst))
+        {
+            return std::string();
+        }
+        switch (Value.Kind)
+        {
+        case ValueKind::Bool:
+        case ValueKind::Number:
+            return Value.Name;
+        case ValueKind::Integer:
+            return Value.Name.compare(0, 5, "std::") == 0 ? Value.Name.substr(5) : Value.Name;
+        case ValueKind::Enum:
+            return "int";
+        default:
+            return std::string();
+        }
+    }
+
+    // An extern "C" shim LuaJIT calls directly, for functions whose parameters and result are all plain values. The
+    // function keeps its classic binding, which is all the others have.
+    void GenerateFfiShim(const Node& Item, std::string& Scope, Fragment& Out)
+    {
+        if (Item.IsCFunction || Item.Function == FunctionType::Property || IsValueClass(Out.Class))
+        {
+            return;
+        }
+        std::string Return;
+        std::vector<std::string> Params;
+        SplitSignature(Item.Signature, Return, Params);
+        auto CReturn = (Return == "void") ? Return : ToFfiType(Return, Scope, false);
+        if (CReturn.empty())
+        {
+            return;
+        }
+        std::vector<std::string> CParams;
+        for (auto& Param : Params)
+        {
+            CParams.push_back(ToFfiType(Param, Scope, true));
+            if (CParams.back().empty())
+            {
+                return;
+            }
+        }
+
+        bool bMethod = (Item.Function == FunctionType::Common && Out.Class);
+        auto ClassName = Scope.substr(0, Scope.size() < 2 ? 0 : Scope.size() - 2);
+        auto ShimName = "lab_ffi_" + Out.FilePrefix + "_" + MakeShardName(Scope + Item.Name);
+        auto Path = GetBindingPath(Out, Item.Function == FunctionType::Global);
+        auto Declaration = CReturn + " " + ShimName + "(";
+        std::string Arguments;
+        // What the lua wrapper hands the shim. LuaJIT would pass a userdata object as a pointer to its payload, so
+        // Self goes through Address.
+        std::string CallArguments;
+        std::string Call = bMethod ? "static_cast<" + std::string(Item.IsConst ? "const " : "") + ClassName + "*>(Self)->" + Item.Name + "(" : Scope + Item.Name + "(";
+        if (bMethod)
+        {
+            Declaration += "void* Self";
+            Arguments = "Self";
+            CallArguments = "Addresses[\"" + Path + "\"](Self)";
+        }
+        for (size_t i = 0; i < Params.size(); ++i)
+        {
+            auto Name = "A" + std::to_string(i);
+            auto Separator = Arguments.empty() ? "" : ", ";
+            Declaration.append(Separator).append(CParams[i] + " " + Name);
+            Arguments.append(Separator).append(Name);
+            CallArguments.append(Separator).append(Name);
+            auto Value = ClassifyType(Params[i], Scope);
+            Call.append(i ? ", " : "").append(Value.Kind == ValueKind::Enum ? "static_cast<" + Value.Name + ">(" + Name + ")" : Name);
+        }
+        // An empty list would leave the parameters unspecified to C
+        Declaration += Arguments.empty() ? "void)" : ")";
+        Call += ")";
+        if (ClassifyType(Return, Scope).Kind == ValueKind::Enum)
+        {
+            Call = "static_cast<int>(" + Call + ")";
+        }
+        Out.ssDirect << "extern \"C\" LAB_FFI_EXPORT " << Declaration << "\n{\n\t" << (CReturn == "void" ? "" : "return ") << Call << ";\n}\n\n";
+        Out.ssFfiCdef << Declaration << ";\n";
+
+        if (bMethod && Out.FfiClasses.insert(Out.Class).second)
+        {
+            Out.ssThunk << "\tlab::BindAddress<" << ClassName << ">(L);\n";
+            Out.ssFfiLua << "Addresses[\"" << Path << "\"] = Address(\"" << Path << "\")\n"
+                << "Table(\"" << Path << "\").Address = Addresses[\"" << Path << "\"]\n";
+        }
+        Out.ssFfiLua << "Table(\"" << Path << "\")." << Item.GetExportName() << " = function(" << Arguments << ") return C." << ShimName << "(" << CallArguments << ") end\n";
+    }
+
+    std::string GetFfiModule()
+    {
+        std::stringstream ss;
+        ss << "-- Generated by lab. LuaJIT FFI wrappers of the extern \"C\" shims in the generated bindings, require it after\n"
+            << "-- RegisterAPIs. A class with methods here has Address(object), the pointer its methods take as self. Passing the\n"
+            << "-- object itself works too, but converts it on every call.\n"
+            << "local ffi = require(\"ffi\")\n\nffi.cdef[[\n";
+        auto Order = SortFilesByIncludes();
+        for (auto Index : Order)
+        {
+            ss << Fragments[Index].ssFfiCdef.str();
+        }
+        ss << "]]\n\nlocal C = ffi.C\nlocal M = {}\n\n"
+            << "local function Table(Path)\n\tlocal t = M\n\tfor Name in Path:gmatch(\"[^.]+\") do\n\t\tt[Name] = t[Name] or {}\n\t\tt = t[Name]\n\tend\n\treturn t\nend\n\n"
+            << "local function Global(Path)\n\tlocal t = _G\n\tfor Name in Path:gmatch(\"[^.]+\") do\n\t\tt = t[Name]\n\tend\n\treturn t\nend\n\n"
+            << "-- The object pointer as a cdata, traces passing a light userdata to a pointer argument are not compiled. A pointer\n"
+            << "-- passes through unchanged, anything else goes to FfiAddress, which raises an error unless it is an object of the class.\n"
+            << "local VoidPointer = ffi.typeof(\"void*\")\n"
+            << "local function Address(Path)\n\tlocal FfiAddress = Global(Path).FfiAddress\n"
+            << "\treturn function(Object)\n\t\tif ffi.istype(VoidPointer, Object) then\n\t\t\treturn Object\n\t\tend\n"
+            << "\t\treturn ffi.cast(VoidPointer, FfiAddress(Object))\n\tend\nend\n\n"
+            << "-- Address of every class by its lua path, what the method wrappers convert Self with\n"
+            << "local Addresses = {}\n\n";
+        for (auto Index : Order)
+        {
+            ss << Fragments[Index].ssFfiLua.str();
+        }
+        ss << "\nreturn M\n";
+        return ss.str();
+    }
+
+    // Declares the buffers of the StringMode::Reuse arguments Code converts, nothing when it has none
+    static std::string DeclareStrings(const std::string& Code, const char* Indent)
+    {
+        size_t Count = 0;
+        for (auto Found = Code.find("Strings.Get("); Found != std::string::npos; Found = Code.find("Strings.Get(", Found + 1))
+        {
+            ++Count;
+        }
+        return Count ? Indent + ("lab::direct::StringArguments<" + std::to_string(Count) + "> Strings;\n") : std::string();
+    }
+
+    // The call of a thunk with the arguments converted from First on, the object is Self for a method
+    std::string MakeCall(const Node& Item, std::string& Scope, const std::vector<std::string>& Params, bool bMethod, int First)
+    {
+        std::string Call = (bMethod ? "Self->" + Item.Name : Scope + Item.Name) + "(";
+        for (size_t i = 0; i < Params.size(); ++i)
+        {
+            auto Argument = ToArgument(Params[i], Scope, static_cast<int>(First + i));
+            if (Argument.empty())
+            {
+                Argument = "lab::portal::Get<lab::ArgumentOf<decltype(&" + Scope + Item.Name + "), " + std::to_string(i) + ">::Type>(L, " + std::to_string(First + i) + ")";
+            }
+            Call.append(i ? ", " : "").append(Argument);
+        }
+        return Call + ")";
+    }
+
+    // "<Name>Batch" takes one array per argument, the objects first for a method, and calls the function once per
+    // index in a single crossing. Results are collected into an array. A method variant is a static of the class.
+    void GenerateBatchThunk(const Node& Item, std::string& Scope, Fragment& Out, const std::string& ClassName, const std::string& ThunkName,
+        bool bMethod, const std::string& Return, const std::vector<std::string>& Params)
+    {
+        auto Arrays = static_cast<int>(Params.size()) + (bMethod ? 1 : 0);
+        bool bResults = Return != "void";
+        // The arrays, the results and then the elements of the current index, one slot each
+        auto Top = std::to_string(Arrays + (bResults ? 1 : 0));
+        auto First = Arrays + (bResults ? 2 : 1);
+
+        auto& ss = Out.ssDirect;
+        ss << BeginThunk(Out, ThunkName, GetBindingName(Item, Out, Item.GetExportName() + "Batch"))
+            << "\tauto Count = lab::batch::CheckCount(L, " << Arrays << ");\n";
+        if (bResults)
+        {
+            ss << "\tlua_createtable(L, static_cast<int>(Count), 0);\n";
+        }
+        auto Call = MakeCall(Item, Scope, Params, bMethod, bMethod ? First + 1 : First);
+        ss << "\tfor (lua_Integer i = 1; i <= Count; ++i)\n\t{\n"
+            << "\t\tlab::batch::PushItems(L, " << Arrays << ", i);\n" << DeclareStrings(Call, "\t\t");
+        if (bMethod)
+        {
+            ss << "\t\tauto Self = " << GetSelf(Out, ClassName, Item.IsConst, First) << ";\n";
+        }
+        if (bResults)
+        {
+            ss << "\t\t" << ToPush(Return, Scope, Call) << ";\n\t\tlua_rawseti(L, " << Top << ", i);\n";
+        }
+        else
+        {
+            ss << "\t\t" << Call << ";\n";
+        }
+        ss << "\t\tlua_settop(L, " << Top << ");\n\t}\n\treturn " << (bResults ? 1 : 0) << ";\n}\n\n";
+
+        auto Name = Item.GetExportName() + "Batch";
+        if (Item.Function == FunctionType::Common && !Out.Class)
+        {
+            Out.ssThunk << "\tlab::BindCFunction(L, \"" << Out.LuaPath << "\", \"" << Name << "\", &" << ThunkName << ");\n";
+        }
+        else if (Item.Function == FunctionType::Global)
+        {
+            auto& Stream = Out.GlobalThunk ? *Out.GlobalThunk : Out.ssThunk;
+            Stream << "\tlab::BindCFunction(L, \"\", \"" << Name << "\", &" << ThunkName << ");\n";
+        }
+        else if (Out.Tables)
+        {
+            Out.Tables->Statics << "\t\t\t{ \"" << Name << "\", &" << ThunkName << " },\n";
+        }
+        else
+        {
+            Out.ssThunk << "\tlab::BindCStatic<" << ClassName << ">(L, \"" << Name << "\", &" << ThunkName << ");\n";
+        }
+        Out.ThunkKeys.push_back(ThunkName);
+    }
+
+    void AddIndexMember(Fragment& Out, Fragment::IndexMember Member)
+    {
+        if (Index == CodeGenerator::IndexMode::Hash)
+        {
+            Out.Tables->Index.push_back(std::move(Member));
+        }
+    }
+
+    static std::string TableEntry(const Node& Item, const std::string& ThunkName)
+    {
+        return "\t\t\t{ \"" + Item.GetExportName() + "\", &" + ThunkName + " },\n";
+    }
+
+    // Where the classic binding puts a member of the current class or namespace, a class is below the namespaces it
+    // is declared in and global functions are at the top
+    static std::string GetBindingPath(const Fragment& Out, bool bGlobal)
+    {
+        if (bGlobal)
+        {
+            return std::string();
+        }
+        auto Path = Out.LuaPath;
+        if (Out.Class)
+        {
+            Path.append(Path.empty() ? "" : ".").append(Out.Class->GetExportName());
+        }
+        return Path;
+    }
+
+    static std::string GetBindingName(const Node& Item, const Fragment& Out, const std::string& Name)
+    {
+        auto Path = GetBindingPath(Out, Item.Function == FunctionType::Global);
+        return Path.empty() ? Name : Path + "." + Name;
+    }
+
+    // Opens the definition of a thunk. With ProfileMode::Calls it first counts the call into the next slot of the
+    // profile array of the file, reported under Name, which for setters is the member followed by "=".
+    std::string BeginThunk(Fragment& Out, const std::string& ThunkName, const std::string& Name)
+    {
+        auto Head = "static int " + ThunkName + "(lua_State* L)\n{\n";
+        if (Profile == CodeGenerator::ProfileMode::Calls)
+        {
+            Head += "\tLAB_PROFILE_CALL(Profile_" + Out.FilePrefix + "[" + std::to_string(Out.Profiled.size()) + "]);\n";
+            Out.Profiled.push_back(Name);
+        }
+        return Head;
+    }
+
+    // Getter thunk of a property and, when it has one, a setter thunk taking the type the getter returns
+    void GenerateDirectProperty(const Node& Item, std::string& Scope, Fragment& Out, const std::string& ClassName, const std::string& ThunkName)
+    {
+        std::string Return;
+        std::vector<std::string> Params;
+        SplitSignature(Item.Signature, Return, Params);
+
+        auto& ss = Out.ssDirect;
+        ss << BeginThunk(Out, ThunkName, GetBindingName(Item, Out, Item.GetExportName()))
+            << "\tauto Self = " << GetSelf(Out, ClassName, Item.IsConst) << ";\n"
+            << "\t" << ToPush(Return, Scope, "Self->" + Item.Name + "()") << ";\n\treturn 1;\n}\n\n";
+        auto Setter = Item.Detail.empty() ? std::string() : ThunkName + "_Set";
+        AddIndexMember(Out, { Item.GetExportName(), ThunkName, Setter, false, Item.IsConst });
+        Out.ThunkKeys.push_back(ThunkName);
+        if (Out.Tables)
+        {
+            (Item.IsConst ? Out.Tables->ConstGetters : Out.Tables->Getters) << TableEntry(Item, ThunkName);
+        }
+        else
+        {
+            BindProperty(Item.GetExportName(), ClassName, ThunkName, Setter, Out);
+        }
+        if (Setter.empty())
+        {
+            return;
+        }
+
+        // The setter receives what the getter hands out, a reference the getter returns is set from a const one
+        auto Value = Return.compare(0, 6, "const ") == 0 ? Return.substr(6) : Return;
+        if (!Value.empty() && Value.back() == '&')
+        {
+            Value = "const " + Value;
+        }
+        auto Argument = ToArgument(Value, Scope, 2);
+        if (Argument.empty())
+        {
+            Argument = "lab::portal::Get<lab::ArgumentOf<decltype(&" + Scope + Item.Detail + "), 0>::Type>(L, 2)";
+        }
+        ss << BeginThunk(Out, Setter, GetBindingName(Item, Out, Item.GetExportName()) + "=") << DeclareStrings(Argument, "\t")
+            << "\tauto Self = " << GetSelf(Out, ClassName, false) << ";\n"
+            << "\tSelf->" << Item.Detail << "(" << Argument << ");\n\treturn 0;\n}\n\n";
+        if (Out.Tables)
+        {
+            Out.Tables->Setters << TableEntry(Item, Setter);
+        }
+        Out.ThunkKeys.push_back(Setter);
+    }
+
+    // A property bound one by one, its getter serves const and non const objects
+    static void BindProperty(const std::string& Name, const std::string& ClassName, const std::string& Getter, const std::string& Setter, Fragment& Out)
+    {
+        Out.ssThunk << "\tlab::BindCProperty<" << ClassName << ">(L, \"" << Name << "\", &" << Getter << ", " << (Setter.empty() ? "nullptr" : "&" + Setter) << ");\n";
+    }
+
+    // Splits "R(A, B)" into R and its parameter types, commas inside template arguments or function types are kept
+    static void SplitSignature(const std::string& Signature, std::string& Return, std::vector<std::string>& Params)
+    {
+        size_t Open = Signature.size();
+        for (int Depth = 0; Open-- > 0;)
+        {
+            Depth += (Signature[Open] == ')') - (Signature[Open] == '(');
+            if (Depth == 0)
+            {
+                break;
+            }
+        }
+        Return = Signature.substr(0, Open);
+        int Depth = 0;
+        size_t Start = Open + 1;
+        for (size_t i = Start; i + 1 < Signature.size(); ++i)
+        {
+            auto c = Signature[i];
+            Depth += (c == '<' || c == '(') - (c == '>' || c == ')');
+            if (c == ',' && Depth == 0)
+            {
+                Params.push_back(Signature.substr(Start, i - Start));
+                Start = i + 2;
+            }
+        }
+        if (Start + 1 < Signature.size())
+        {
+            Params.push_back(Signature.substr(Start, Signature.size() - 1 - Start));
+        }
+    }
+
+    enum class ValueKind : uint8_t
+    {
+        Other,
+        Bool,
+        Integer,
+        Number,
+        String,
+        StringView,
+        Enum,
+        Class,
+        // LUA_CLASS(value)
+        Value
+    };
+
+    // Types converted without going through luaportal, spelled the way hp writes them
+    static ValueKind GetPrimitiveKind(const std::string& Type)
+    {
+        static const std::unordered_map<std::string, ValueKind> Types = {
+            { "bool", ValueKind::Bool }, { "char", ValueKind::Integer }, { "signed char", ValueKind::Integer }, { "unsigned char", ValueKind::Integer },
+            { "short", ValueKind::Integer }, { "unsigned short", ValueKind::Integer }, { "int", ValueKind::Integer }, { "unsigned", ValueKind::Integer }, { "unsigned int", ValueKind::Integer },
+            { "long", ValueKind::Integer }, { "unsigned long", ValueKind::Integer }, { "long long", ValueKind::Integer }, { "unsigned long long", ValueKind::Integer },
+            { "int8_t", ValueKind::Integer }, { "uint8_t", ValueKind::Integer }, { "int16_t", ValueKind::Integer }, { "uint16_t", ValueKind::Integer },
+            { "int32_t", ValueKind::Integer }, { "uint32_t", ValueKind::Integer }, { "int64_t", ValueKind::Integer }, { "uint64_t", ValueKind::Integer },
+            { "std::int8_t", ValueKind::Integer }, { "std::uint8_t", ValueKind::Integer }, { "std::int16_t", ValueKind::Integer }, { "std::uint16_t", ValueKind::Integer },
+            { "std::int32_t", ValueKind::Integer }, { "std::uint32_t", ValueKind::Integer }, { "std::int64_t", ValueKind::Integer }, { "std::uint64_t", ValueKind::Integer },
+            { "size_t", ValueKind::Integer }, { "std::size_t", ValueKind::Integer },
+            { "float", ValueKind::Number }, { "double", ValueKind::Number }, { "std::string", ValueKind::String },
+            { "std::string_view", ValueKind::StringView },
+        };
+        auto itr = Types.find(Type);
+        return itr == Types.end() ? ValueKind::Other : itr->second;
+    }
+
+    // A parameter or return type taken apart: "const Name&" is Const, Name and '&'
+    struct ValueType
+    {
+        ValueKind Kind = ValueKind::Other;
+        std::string Name;
+        bool IsConst = false;
+        char Indirection = 0;
+    };
+
+    ValueType ClassifyType(const std::string& Type, const std::string& Scope)
+    {
+        ValueType Result;
+        Result.Name = Type;
+        auto& Name = Result.Name;
+        auto EndsWith = [&](const char* Suffix) {
+            auto Length = std::strlen(Suffix);
+            return Name.size() >= Length && Name.compare(Name.size() - Length, Length, Suffix) == 0;
+        };
+        if (Name.compare(0, 6, "const ") == 0)
+        {
+            Result.IsConst = true;
+            Name.erase(0, 6);
+        }
+        if (EndsWith("&&"))
+        {
+            return Result;
+        }
+        if (EndsWith(" const"))
+        {
+            Name.resize(Name.size() - 6);
+        }
+        if (EndsWith("&") || EndsWith("*"))
+        {
+            Result.Indirection = Name.back();
+            Name.pop_back();
+        }
+        Result.Kind = GetPrimitiveKind(Name);
+        if (Result.Kind == ValueKind::Other)
+        {
+            auto Qualified = FindType(Scope, Name);
+            auto itr = TypeIndex.find(Qualified);
+            if (itr != TypeIndex.end())
+            {
+                Result.Kind = (itr->second == NodeKind::Enum) ? ValueKind::Enum
+                    : ValueClasses.count(Qualified) ? ValueKind::Value : ValueKind::Class;
+                Name = Qualified;
+            }
+        }
+        return Result;
+    }
+
+    // Qualified name Name refers to from inside Scope, Name itself when it is not a class or enum of the ast
+    std::string FindType(const std::string& Scope, const std::string& Name)
+    {
+        auto Qualified = Name.compare(0, 2, "::") == 0 ? Name.substr(2) : Name;
+        auto Prefix = Scope;
+        while (true)
+        {
+            if (TypeIndex.count(Prefix + Qualified))
+            {
+                return Prefix + Qualified;
+            }
+            if (Prefix.empty())
+            {
+                return Qualified;
+            }
+            auto Pos = Prefix.rfind("::", Prefix.size() - 3);
+            Prefix.resize(Pos == std::string::npos ? 0 : Pos + 2);
+        }
+    }
+
+    // Expression converting argument Index to Type, empty when luaportal has to convert it
+    std::string ToArgument(const std::string& Type, const std::string& Scope, int Index)
+    {
+        auto Value = ClassifyType(Type, Scope);
+        auto Arg = std::to_string(Index);
+        if (Value.Kind == ValueKind::Value)
+        {
+            auto Object = "lab::ToValue<" + Value.Name + ">(L, " + Arg + ")";
+            return Value.Indirection == '*' ? Object : "*" + Object;
+        }
+        if (Value.Kind == ValueKind::Class)
+        {
+            auto Object = "lab::portal::GetObject<" + Value.Name + ">(L, " + Arg + (Value.IsConst || !Value.Indirection ? ", true)" : ", false)");
+            return Value.Indirection == '*' ? Object : "*" + Object;
+        }
+        if (Value.Name == "char" && Value.Indirection == '*' && Value.IsConst)
+        {
+            return "luaL_checkstring(L, " + Arg + ")";
+        }
+        // Plain values travel by value or const reference, anything a function could write through is left to luaportal
+        if (Value.Indirection && !(Value.Indirection == '&' && Value.IsConst))
+        {
+            return std::string();
+        }
+        switch (Value.Kind)
+        {
+        case ValueKind::Bool:
+            return "lua_toboolean(L, " + Arg + ") != 0";
+        case ValueKind::Integer:
+        case ValueKind::Enum:
+            return "static_cast<" + Value.Name + ">(luaL_checkinteger(L, " + Arg + "))";
+        case ValueKind::Number:
+            return "static_cast<" + Value.Name + ">(luaL_checknumber(L, " + Arg + "))";
+        case ValueKind::String:
+            // The reused buffer can only stand in for a reference, a value parameter owns its string
+            if (Strings == CodeGenerator::StringMode::Reuse && Value.Indirection == '&')
+            {
+                return "Strings.Get(L, " + Arg + ")";
+            }
+            return "lab::direct::ToString(L, " + Arg + ")";
+        case ValueKind::StringView:
+            return "lab::direct::ToStringView(L, " + Arg + ")";
+        default:
+            return std::string();
+        }
+    }
+
+    // Statement pushing the value of Call, which returns Type
+    std::string ToPush(const std::string& Type, const std::string& Scope, const std::string& Call)
+    {
+        auto Value = ClassifyType(Type, Scope);
+        if (Value.Name == "char" && Value.Indirection == '*' && Value.IsConst)
+        {
+            return "lua_pushstring(L, " + Call + ")";
+        }
+        // Values are copied whichever way the function hands them out
+        if (Value.Kind == ValueKind::Value)
+        {
+            return "lab::PushValue(L, " + Call + ")";
+        }
+        if (Value.Indirection == '*')
+        {
+            bool bCached = (Pointers == CodeGenerator::PointerMode::Cached && Value.Kind == ValueKind::Class);
+            return (bCached ? "lab::PushObject(L, " : "lab::portal::Push(L, ") + Call + ")";
+        }
+        switch (Value.Kind)
+        {
+        case ValueKind::Bool:
+            return "lua_pushboolean(L, " + Call + " ? 1 : 0)";
+        case ValueKind::Integer:
+        case ValueKind::Enum:
+            return "lua_pushinteger(L, static_cast<lua_Integer>(" + Call + "))";
+        case ValueKind::Number:
+            return "lua_pushnumber(L, static_cast<lua_Number>(" + Call + "))";
+        case ValueKind::String:
+        case ValueKind::StringView:
+            return "lab::direct::PushString(L, " + Call + ")";
+        default:
+            return "lab::portal::Push(L, " + Call + ")";
+        }
+    }
+
+    void IndexTypes()
+    {
+        TypeIndex.clear();
+        ValueClasses.clear();
+        std::string Scope;
+        for (auto& File : Files)
+        {
+            IndexTypes(File.Nodes, Scope);
+        }
+    }
+
+    void IndexTypes(const std::vector<Node>& Nodes, std::string& Scope)
+    {
+        for (auto& Item : Nodes)
+        {
+            if (Item.Kind == NodeKind::Enum || Item.Kind == NodeKind::Class)
+            {
+                TypeIndex[Scope + Item.Name] = Item.Kind;
+            }
+            if (Item.Kind == NodeKind::Class && Item.IsValue)
+            {
+                ValueClasses.insert(Scope + Item.Name);
+            }
+            if (Item.Kind == NodeKind::Namespace || Item.Kind == NodeKind::Class)
+            {
+                auto ScopeSize = Scope.size();
+                Scope.append(Item.Name).append("::");
+                IndexTypes(Item.Children, Scope);
+                Scope.resize(ScopeSize);
+            }
+        }
+    }
+
+    void GenerateEnum(const Node& Item, std::string& Scope, Fragment& Out)
+    {
+        if (Enums == CodeGenerator::EnumMode::Sized)
+        {
+            GenerateSizedEnum(Item, Scope, Out);
+            return;
+        }
+        Out.ssNormal << "\t.BeginEnum<" << Scope << Item.Name << ">(\"" << Item.GetExportName() << "\")\n";
+        for (auto& Value : Item.Children)
+        {
+            Out.ssNormal << "\t.AddEnumValue(\"" << Value.Name << "\", " << Scope << Item.Name << "::" << Value.Name << ")\n";
+        }
+        Out.ssNormal << "\t.EndEnum()\n";
+    }
+
+    // The values go into a static array bound after the chain, the table is created with room for all of them
+    void GenerateSizedEnum(const Node& Item, std::string& Scope, Fragment& Out)
+    {
+        auto Count = Item.Children.size();
+        Out.ssThunk << "\t{\n";
+        if (Count)
+        {
+            Out.ssThunk << "\t\tstatic const lab::EnumValue Values[] = {\n";
+            for (auto& Value : Item.Children)
+            {
+                Out.ssThunk << "\t\t\t{ \"" << Value.Name << "\", static_cast<lua_Integer>(" << Scope << Item.Name << "::" << Value.Name << ") },\n";
+            }
+            Out.ssThunk << "\t\t};\n";
+        }
+        auto Values = Count ? "Values" : "nullptr";
+        // A value class has no luaportal class to hold its enums, they stay in the namespace
+        if (Out.Class && !IsValueClass(Out.Class))
+        {
+            Out.ssThunk << "\t\tlab::BindClassEnum<" << Scope.substr(0, Scope.size() - 2) << ">(L, \"" << Item.GetExportName() << "\", " << Values << ", " << Count << ");\n";
+        }
+        else
+        {
+            Out.ssThunk << "\t\tlab::BindEnum(L, \"" << Out.LuaPath << "\", \"" << Item.GetExportName() << "\", " << Values << ", " << Count << ");\n";
+        }
+        Out.ssThunk << "\t}\n";
+    }
+
+    // Exported virtual methods only, hp does not write the unexported ones
+    static bool HasVirtualMethod(const Node& Class)
+    {
+        for (auto& Child : Class.Children)
+        {
+            if (Child.Kind == NodeKind::Function && Child.IsVirtual)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Types lab/Field.h reads and writes itself
+    static bool IsFieldType(const std::string& Signature)
+    {
+        const std::string Const = "const ";
+        auto Type = Signature.compare(0, Const.size(), Const) == 0 ? Signature.substr(Const.size()) : Signature;
+        auto Kind = GetPrimitiveKind(Type);
+        return Kind != ValueKind::Other && Kind != ValueKind::StringView;
+    }
+
+    // Accessor thunks of a data member, for the perfect hash and for members only thunks can reach. Returns the
+    // setter, or an empty name when the member is read only.
+    std::string GenerateDataThunks(const Node& Item, std::string& Scope, Fragment& Out, const std::string& ThunkName)
+    {
+        auto ClassName = Scope.substr(0, Scope.size() - 2);
+        auto& ss = Out.ssDirect;
+        ss << BeginThunk(Out, ThunkName, GetBindingName(Item, Out, Item.GetExportName()))
+            << "\tauto Self = " << GetSelf(Out, ClassName, true) << ";\n"
+            << "\t" << ToPush(Item.Signature, Scope, "Self->" + Item.Name) << ";\n\treturn 1;\n}\n\n";
+        Out.ThunkKeys.push_back(ThunkName);
+        // A view set from lua would outlive the lua string
+        if (!Item.Writeable || Item.Signature.compare(0, 6, "const ") == 0 || ClassifyType(Item.Signature, Scope).Kind == ValueKind::StringView)
+        {
+            return std::string();
+        }
+        auto Argument = ToArgument(Item.Signature, Scope, 2);
+        if (Argument.empty())
+        {
+            Argument = "lab::portal::Get<decltype(" + ClassName + "::" + Item.Name + ")>(L, 2)";
+        }
+        ss << BeginThunk(Out, ThunkName + "_Set", GetBindingName(Item, Out, Item.GetExportName()) + "=")
+            << "\tauto Self = " << GetSelf(Out, ClassName, false) << ";\n"
+            << "\tSelf->" << Item.Name << " = " << Argument << ";\n\treturn 0;\n}\n\n";
+        Out.ThunkKeys.push_back(ThunkName + "_Set");
+        return ThunkName + "_Set";
+    }
+
+    void GenerateData(const Node& Item, std::string& Scope, Fragment& Out)
+    {
+        auto ThunkName = "Thunk_" + Out.FilePrefix + "_" + MakeShardName(Scope + Item.Name);
+        // Members of a value class, and members of a value type which luaportal can not convert, only exist as thunks
+        if (IsValueClass(Out.Class) || (!Item.IsStatic && Out.Class && IsDirect() && ClassifyType(Item.Signature, Scope).Kind == ValueKind::Value))
+        {
+            if (Item.IsStatic)
+            {
+                // There is no luaportal class to hold static data of a value class
+                return;
+            }
+            auto Setter = GenerateDataThunks(Item, Scope, Out, ThunkName);
+            AddIndexMember(Out, { Item.GetExportName(), ThunkName, Setter, false, true });
+            if (!Out.Tables)
+            {
+                BindProperty(Item.GetExportName(), Scope.substr(0, Scope.size() - 2), ThunkName, Setter, Out);
+                return;
+            }
+            Out.Tables->ConstGetters << TableEntry(Item, ThunkName);
+            if (!Setter.empty())
+            {
+                Out.Tables->Setters << TableEntry(Item, Setter);
+            }
+            if (IsValueClass(Out.Class))
+            {
+                Out.Tables->Fields.push_back(Item.GetExportName());
+            }
+            return;
+        }
+        if (Out.Tables && Index == CodeGenerator::IndexMode::Hash && !Item.IsStatic && IsFieldType(Item.Signature))
+        {
+            auto Setter = GenerateDataThunks(Item, Scope, Out, ThunkName);
+            AddIndexMember(Out, { Item.GetExportName(), ThunkName, Setter, false, true });
+        }
+        if (Out.Fields && !Item.IsStatic && IsFieldType(Item.Signature))
+        {
+            auto ClassName = Scope.substr(0, Scope.size() - 2);
+            *Out.Fields << "\t\t\tlab::MakeField<" << ClassName << ", decltype(" << Scope << Item.Name << "), &" << Scope << Item.Name
+                << ">(\"" << Item.GetExportName() << "\", LAB_FIELD_OFFSET(" << Item.Name << ")" << (Item.Writeable ? ", true" : ", false") << "),\n";
+            return;
+        }
+        Out.ssNormal << (Item.IsStatic ? "\t.AddStaticData(\"" : "\t.AddData(\"") << Item.GetExportName() << "\", &" << Scope << Item.Name << (Item.Writeable ? ", true" : ", false") << ")\n";
+        if (Item.IsStatic && Item.IsAutoNull)
+        {
+            Out.ssAutoNull << "\t" << Scope << Item.Name << " = nullptr;\n";
+        }
+    }
+
+    void IndexPreviousFiles()
+    {
+        PreviousIndex.clear();
+        for (size_t i = 0; i < PreviousFiles.size(); ++i)
+        {
+            PreviousIndex[NormalizePath(PreviousFiles[i].Name)] = i;
+        }
+        RemovedFiles.clear();
+        std::unordered_map<std::string, bool> Current;
+        for (auto& File : Files)
+        {
+            Current[NormalizePath(File.Name)] = true;
+        }
+        for (auto& File : PreviousFiles)
+        {
+            if (!Current.count(NormalizePath(File.Name)))
+            {
+                RemovedFiles.push_back(File.Name);
+            }
+        }
+    }
+
+    void GenerateFileDelta(const HeaderFile& File, Fragment& Out)
+    {
+        auto itr = PreviousIndex.find(NormalizePath(File.Name));
+        auto Previous = (itr == PreviousIndex.end()) ? nullptr : &PreviousFiles[itr->second].Nodes;
+        std::string Scope;
+        GenerateDeltaNodes(File.Nodes, Previous, Scope, Out);
+    }
+
+    // Declarations are matched by kind and name, a class has one constructor
+    static std::string NodeKey(const Node& Item)
+    {
+        return std::to_string(static_cast<int>(Item.Kind)) + Item.Name;
+    }
+
+    // The text the full registration emits plus the declared types, so changed signatures count as changes
+    std::string RenderNode(const Node& Item, std::string& Scope, const Fragment& Out)
+    {
+        Fragment Temp;
+        Temp.Class = Out.Class;
+        Temp.LuaPath = Out.LuaPath;
+        Temp.FilePrefix = Out.FilePrefix;
+        GenerateNode(Item, Scope, Temp);
+        return Temp.ssNormal.str() + Temp.ssGlobal.str() + Temp.ssThunk.str() + Item.Signature;
+    }
+
+    // Registers a declaration in full as part of the delta chain. Direct thunks are left out, the full registration
+    // of the same ast already defines them.
+    void GenerateDeltaWhole(const Node& Item, std::string& Scope, Fragment& Out)
+    {
+        Fragment Temp;
+        Temp.Class = Out.Class;
+        Temp.LuaPath = Out.LuaPath;
+        Temp.FilePrefix = Out.FilePrefix;
+        GenerateNode(Item, Scope, Temp);
+        Out.ssDelta << Temp.ssNormal.str();
+        Out.ssDeltaGlobal << Temp.ssGlobal.str();
+        Out.ssDeltaThunk << Temp.ssThunk.str();
+    }
+
+    // Emits what is new or changed in Nodes compared to OldNodes, which is null when the whole scope is new
+    void GenerateDeltaNodes(const std::vector<Node>& Nodes, const std::vector<Node>* OldNodes, std::string& Scope, Fragment& Out)
+    {
+        std::unordered_map<std::string, size_t> OldIndex;
+        std::vector<bool> Matched;
+        if (OldNodes)
+        {
+            Matched.resize(OldNodes->size());
+            for (size_t i = OldNodes->size(); i-- > 0;)
+            {
+                OldIndex[NodeKey((*OldNodes)[i])] = i;
+            }
+        }
+
+        for (auto& Item : Nodes)
+        {
+            const Node* Old = nullptr;
+            auto itr = OldIndex.find(NodeKey(Item));
+            if (itr != OldIndex.end())
+            {
+                Old = &(*OldNodes)[itr->second];
+                Matched[itr->second] = true;
+            }
+
+            switch (Item.Kind)
+            {
+            case NodeKind::Namespace:
+                GenerateDeltaScope(Item, Old, Scope, Out);
+                break;
+            case NodeKind::Class:
+                // A value class is one lab::ValueClass, binding it again replaces every member at once
+                if (IsValueClass(&Item))
+                {
+                    if (!Old || RenderNode(*Old, Scope, Out) != RenderNode(Item, Scope, Out))
+                    {
+                        GenerateDeltaWhole(Item, Scope, Out);
+                    }
+                }
+                // A class with a new parent can not be patched in place
+                else if (Old && Old->Detail == Item.Detail && !IsValueClass(Old))
+                {
+                    GenerateDeltaScope(Item, Old, Scope, Out);
+                }
+                else
+                {
+                    GenerateDeltaWhole(Item, Scope, Out);
+                }
+                break;
+            case NodeKind::Enum:
+                GenerateDeltaEnum(Item, Old, Scope, Out);
+                break;
+            default:
+                if (!Old || RenderNode(*Old, Scope, Out) != RenderNode(Item, Scope, Out))
+                {
+                    GenerateDeltaWhole(Item, Scope, Out);
+                }
+                break;
+            }
+        }
+
+        for (size_t i = 0; i < Matched.size(); ++i)
+        {
+            if (!Matched[i])
+            {
+                auto& Removed = (*OldNodes)[i];
+                Out.ssRemoved << "\t// removed " << Scope << (Removed.Kind == NodeKind::Constructor ? "constructor" : Removed.Name) << ", still registered until restart\n";
+            }
+        }
+    }
+
+    // Reopens a namespace or class only when something inside it changed
+    void GenerateDeltaScope(const Node& Item, const Node* Old, std::string& Scope, Fragment& Out)
+    {
+        Fragment Inner;
+        Inner.Class = Out.Class;
+        Inner.LuaPath = Out.LuaPath;
+        Inner.FilePrefix = Out.FilePrefix;
+        auto ScopeSize = Scope.size();
+        EnterScope(Item, Scope, Inner);
+        GenerateDeltaNodes(Item.Children, Old ? &Old->Children : nullptr, Scope, Inner);
+        Scope.resize(ScopeSize);
+
+        Out.ssRemoved << Inner.ssRemoved.str();
+        Out.ssDeltaGlobal << Inner.ssDeltaGlobal.str();
+        Out.ssDeltaThunk << Inner.ssDeltaThunk.str();
+        auto Body = Inner.ssDelta.str();
+        if (Body.empty())
+        {
+            return;
+        }
+        // The parent is unchanged here. DeriveClass would build new class tables and drop every member the delta does not
+        // list, BeginClass reopens the registered ones
+        if (Item.Kind == NodeKind::Class)
+        {
+            Out.ssDelta << "\t.BeginClass<" << Scope << Item.Name << ">(\"" << Item.GetExportName() << "\")\n" << Body << "\t.EndClass()\n";
+        }
+        else if (Item.ShouldExport)
+        {
+            Out.ssDelta << "\t.BeginNamespace(\"" << Item.GetExportName() << "\")\n" << Body << "\t.EndNamespace()\n";
+        }
+        else
+        {
+            Out.ssDelta << Body;
+        }
+    }
+
+    // Enum values can only be added to a registered enum
+    void GenerateDeltaEnum(const Node& Item, const Node* Old, std::string& Scope, Fragment& Out)
+    {
+        // A sized enum is replaced as a whole once its values differ
+        if (!Old || (Enums == CodeGenerator::EnumMode::Sized && RenderNode(*Old, Scope, Out) != RenderNode(Item, Scope, Out)))
+        {
+            GenerateDeltaWhole(Item, Scope, Out);
+            return;
+        }
+        if (Enums == CodeGenerator::EnumMode::Sized)
+        {
+            return;
+        }
+        std::unordered_map<std::string, bool> OldKeys;
+        for (auto& Value : Old->Children)
+        {
+            OldKeys[Value.Name] = false;
+        }
+        std::stringstream Body;
+        for (auto& Value : Item.Children)
+        {
+            auto itr = OldKeys.find(Value.Name);
+            if (itr == OldKeys.end())
+            {
+                Body << "\t.AddEnumValue(\"" << Value.Name << "\", " << Scope << Item.Name << "::" << Value.Name << ")\n";
+            }
+            else
+            {
+                itr->second = true;
+            }
+        }
+        for (auto& Value : Old->Children)
+        {
+            if (!OldKeys[Value.Name])
+            {
+                Out.ssRemoved << "\t// removed " << Scope << Item.Name << "::" << Value.Name << ", still registered until restart\n";
+            }
+        }
+        auto Values = Body.str();
+        if (!Values.empty())
+        {
+            Out.ssDelta << "\t.BeginEnum<" << Scope << Item.Name << ">(\"" << Item.GetExportName() << "\")\n" << Values << "\t.EndEnum()\n";
+        }
+    }
+
+    static std::string NormalizePath(const std::string& Path)
+    {
+        std::string Result = Path;
+        std::replace(Result.begin(), Result.end(), '\\', '/');
+        while (Result.compare(0, 2, "./") == 0)
+        {
+            Result.erase(0, 2);
+        }
+        return Result;
+    }
+
+    // Sorts by name and merges files loaded from several asts, the one loaded first is kept
+    static void SortFiles(std::vector<HeaderFile>& FileList)
+    {
+        std::vector<std::string> Keys;
+        Keys.reserve(FileList.size());
+        std::vector<size_t> Order;
+        for (size_t i = 0; i < FileList.size(); ++i)
+        {
+            Keys.push_back(NormalizePath(FileList[i].Name));
+            Order.push_back(i);
+        }
+        std::stable_sort(Order.begin(), Order.end(), [&](size_t lhs, size_t rhs) {
+            return Keys[lhs] < Keys[rhs];
+        });
+
+        std::vector<HeaderFile> Sorted;
+        Sorted.reserve(FileList.size());
+        for (size_t i = 0; i < Order.size(); ++i)
+        {
+            auto& File = FileList[Order[i]];
+            if (i > 0 && Keys[Order[i]] == Keys[Order[i - 1]])
+            {
+                auto& Kept = Sorted.back();
+                if (Kept.Nodes.size() != File.Nodes.size() || Kept.IncludeFiles != File.IncludeFiles)
+                {
+                    std::cerr << "Warning: " << File.Name << " differs between asts, using the first one" << std::endl;
+                }
+                continue;
+            }
+            Sorted.push_back(std::move(File));
+        }
+        FileList.swap(Sorted);
+    }
+
+    void BuildFileIndex()
+    {
+        FileIndex.clear();
+        for (size_t i = 0; i < Files.size(); ++i)
+        {
+            auto Path = NormalizePath(Files[i].Name);
+            for (size_t Pos = 0; Pos != std::string::npos; )
+            {
+                FileIndex[Path.substr(Pos)].push_back(i);
+                Pos = Path.find('/', Pos);
+                if (Pos != std::string::npos)
+                {
+                    ++Pos;
+                }
+            }
+        }
+    }
+
+    // Returns the index of the file an include names, or Files.size() if it is not part of the ast
+    size_t ResolveInclude(const std::string& IncludeFileName)
+    {
+        auto itr = FileIndex.find(NormalizePath(IncludeFileName));
+        if (itr == FileIndex.end())
+        {
+            return Files.size();
+        }
+        if (itr->second.size() > 1)
+        {
+            std::cerr << "Warning: include \"" << IncludeFileName << "\" is ambiguous, using " << Files[itr->second.front()].Name << std::endl;
+        }
+        return itr->second.front();
+    }
+
+    // Orders files so that each one comes after the files it includes. Roots are visited in name order and
+    // includes in their sorted order, a back edge is reported as a cycle and ignored.
+    std::vector<size_t> SortFilesByIncludes()
+    {
+        BuildFileIndex();
+        std::vector<std::vector<size_t>> Dependencies(Files.size());
+        for (size_t i = 0; i < Files.size(); ++i)
+        {
+            for (auto& IncludeFileName : Files[i].IncludeFiles)
+            {
+                auto Dependency = ResolveInclude(IncludeFileName);
+                if (Dependency != Files.size())
+                {
+                    Dependencies[i].push_back(Dependency);
+                }
+            }
+        }
+
+        enum class Mark : uint8_t {
+            None,
+            Visiting,
+            Done
+        };
+        struct Visit {
+            size_t File;
+            size_t NextDependency;
+        };
+
+        std::vector<Mark> Marks(Files.size(), Mark::None);
+        std::vector<size_t> Order;
+        std::vector<Visit> Stack;
+        Order.reserve(Files.size());
+        for (size_t Root = 0; Root < Files.size(); ++Root)
+        {
+            if (Marks[Root] != Mark::None)
             {
                 continue;
             }
-            auto& ParentName = ParentObject["name"];
-            if (std::string(ParentName["type"].GetString()) != "literal")
+            Marks[Root] = Mark::Visiting;
+            Stack.push_back({ Root, 0 });
+            while (!Stack.empty())
+            {
+                size_t File = Stack.back().File;
+                auto& FileDependencies = Dependencies[File];
+                if (Stack.back().NextDependency == FileDependencies.size())
+                {
+                    Marks[File] = Mark::Done;
+                    Order.push_back(File);
+                    Stack.pop_back();
+                    continue;
+                }
+
+                size_t Next = FileDependencies[Stack.back().NextDependency++];
+                if (Marks[Next] == Mark::None)
+                {
+                    Marks[Next] = Mark::Visiting;
+                    Stack.push_back({ Next, 0 });
+                }
+                else if (Marks[Next] == Mark::Visiting)
+                {
+                    ReportIncludeCycle(Stack, Next);
+                }
+            }
+        }
+        return Order;
+    }
+
+    template<typename VisitStack>
+    void ReportIncludeCycle(const VisitStack& Stack, size_t File)
+    {
+        std::stringstream ss;
+        bool InCycle = false;
+        for (auto& Item : Stack)
+        {
+            InCycle = InCycle || (Item.File == File);
+            if (InCycle)
+            {
+                ss << Files[Item.File].Name << " -> ";
+            }
+        }
+        ss << Files[File].Name;
+        std::cerr << "Warning: include cycle " << ss.str() << std::endl;
+    }
+
+    // How many functions go through thunks and how many thunk functions they need
+    void CountThunks()
+    {
+        if (Thunks == CodeGenerator::ThunkMode::Portal || !stats::IsEnabled())
+        {
+            return;
+        }
+        std::unordered_map<std::string, bool> Distinct;
+        size_t Bindings = 0;
+        for (auto& Item : Fragments)
+        {
+            Bindings += Item.ThunkKeys.size();
+            for (auto& Key : Item.ThunkKeys)
+            {
+                Distinct[Key] = true;
+            }
+        }
+        auto Group = (Thunks == CodeGenerator::ThunkMode::Shared) ? "shared thunks" : "direct thunks";
+        stats::AddCounter(Group, "bindings", Bindings);
+        stats::AddCounter(Group, "thunks", Distinct.size());
+    }
+
+    // How much of the registration lazy namespaces defer, in generated statements
+    void CountModules()
+    {
+        if (Register != CodeGenerator::RegisterMode::Lazy || !stats::IsEnabled())
+        {
+            return;
+        }
+        std::unordered_map<std::string, bool> Names;
+        size_t Deferred = 0;
+        size_t Eager = 0;
+        for (auto& Item : Fragments)
+        {
+            for (auto& Module : Item.Modules)
+            {
+                Names[Module.Name] = true;
+                Deferred += std::count(Module.Normal.begin(), Module.Normal.end(), '\n') + std::count(Module.Thunk.begin(), Module.Thunk.end(), '\n');
+            }
+            for (auto Stream : { &Item.ssNormal, &Item.ssGlobal, &Item.ssThunk })
+            {
+                auto Text = Stream->str();
+                Eager += std::count(Text.begin(), Text.end(), '\n');
+            }
+        }
+        stats::AddCounter("lazy modules", "modules", Names.size());
+        stats::AddCounter("lazy modules", "deferred statements", Deferred);
+        stats::AddCounter("lazy modules", "eager statements", Eager);
+    }
+
+    // Members flattening copies into derived classes, counted on the ast: one per inherited name a class does not
+    // declare itself. The runtime cost is what lab::GetFlattenMetrics reports.
+    void CountFlattened()
+    {
+        if (Inherit != CodeGenerator::InheritMode::Flatten || !stats::IsEnabled())
+        {
+            return;
+        }
+        struct ClassInfo
+        {
+            const Node* Item;
+            std::string Scope;
+        };
+        std::unordered_map<std::string, ClassInfo> Classes;
+        std::function<void(const std::vector<Node>&, std::string&)> IndexClasses = [&](const std::vector<Node>& Nodes, std::string& Scope)
+        {
+            for (auto& Item : Nodes)
+            {
+                if (Item.Kind == NodeKind::Class)
+                {
+                    Classes[Scope + Item.Name] = { &Item, Scope };
+                }
+                if (Item.Kind == NodeKind::Namespace || Item.Kind == NodeKind::Class)
+                {
+                    auto ScopeSize = Scope.size();
+                    Scope.append(Item.Name).append("::");
+                    IndexClasses(Item.Children, Scope);
+                    Scope.resize(ScopeSize);
+                }
+            }
+        };
+        std::string Scope;
+        for (auto& File : Files)
+        {
+            IndexClasses(File.Nodes, Scope);
+        }
+
+        auto FindBase = [&](const ClassInfo& Info) -> const ClassInfo*
+        {
+            auto& Name = Info.Item->Detail;
+            auto Qualified = Name.compare(0, 2, "::") == 0 ? Name.substr(2) : Name;
+            auto Prefix = Info.Scope;
+            while (true)
+            {
+                auto itr = Classes.find(Prefix + Qualified);
+                if (itr != Classes.end())
+                {
+                    return &itr->second;
+                }
+                if (Prefix.empty())
+                {
+                    return nullptr;
+                }
+                auto Pos = Prefix.rfind("::", Prefix.size() - 3);
+                Prefix.resize(Pos == std::string::npos ? 0 : Pos + 2);
+            }
+        };
+        auto AddMembers = [](const Node& Class, std::unordered_set<std::string>& Names)
+        {
+            size_t Added = 0;
+            for (auto& Child : Class.Children)
+            {
+                bool bMember = (Child.Kind == NodeKind::Function && (Child.Function == FunctionType::Common || Child.Function == FunctionType::Property))
+                    || (Child.Kind == NodeKind::Data && !Child.IsStatic);
+                if (bMember && Names.insert(Child.GetExportName()).second)
+                {
+                    ++Added;
+                }
+            }
+            return Added;
+        };
+
+        size_t Flattened = 0;
+        size_t Inherited = 0;
+        for (auto& Entry : Classes)
+        {
+            if (Entry.second.Item->Detail.empty())
             {
                 continue;
             }
-            OutParentClassName = ParentName["name"].GetString();
-            return true;
+            ++Flattened;
+            std::unordered_set<std::string> Names;
+            AddMembers(*Entry.second.Item, Names);
+            // Bounded by the class count in case the ast describes a cycle
+            auto Base = FindBase(Entry.second);
+            for (size_t Depth = 0; Base && Depth < Classes.size(); ++Depth)
+            {
+                Inherited += AddMembers(*Base->Item, Names);
+                Base = Base->Item->Detail.empty() ? nullptr : FindBase(*Base);
+            }
         }
-        return false;
+        stats::AddCounter("flatten", "derived classes", Flattened);
+        stats::AddCounter("flatten", "inherited members", Inherited);
     }
 
     std::string GetResult()
     {
-        std::stringstream ss;
-        ss << ssInclude.str() << std::endl
-            << "void RegisterAPIs(luaportal::LuaState& LOL) \n{\n\tLOL.GlobalContext()\n"
-            << ssNormal.str()
-            << ssGlobal.str() 
-            << "\t;\n}\n\n"
-            << "void UnregisterStaticLuaProperties() \n{\n"
-            << ssAutoNull.str()
-            << "}\n";
-        return ss.str();
+        stats::ScopedSpan Span("emit");
+        GenerateCode();
+        CountThunks();
+        CountModules();
+        CountFlattened();
+        return ComposeUnit(SortFilesByIncludes(), "");
+    }
+
+    static std::string MakeShardName(const std::string& FileName)
+    {
+        auto Name = NormalizePath(FileName);
+        for (auto& c : Name)
+        {
+            if (!isalnum(static_cast<unsigned char>(c)))
+            {
+                c = '_';
+            }
+        }
+        return Name;
     }
 
+    std::vector<CodeGenerator::Shard> GetShardedResult(size_t FilesPerShard)
+    {
+        stats::ScopedSpan Span("emit", "sharded");
+        GenerateCode();
+        CountThunks();
+        CountModules();
+        CountFlattened();
+        std::vector<CodeGenerator::Shard> Result(1);
+        std::unordered_map<std::string, size_t> UsedNames;
+
+        // Shards are cut from the include order, so calling them in sequence keeps parents before children
+        std::vector<size_t> Group;
+        auto Flush = [&]()
+        {
+            if (Group.empty())
+            {
+                return;
+            }
+            // Named after the first header so a shard keeps its name while other headers come and go
+            auto Name = MakeShardName(Files[Group.front()].Name);
+            auto Count = ++UsedNames[Name];
+            if (Count > 1)
+            {
+                Name += "_" + std::to_string(Count);
+            }
+            stats::ScopedSpan ShardSpan("emit/shard", Name);
+            Result.push_back({ Name, ComposeUnit(Group, "_" + Name) });
+            Group.clear();
+        };
+        std::stringstream RootRemoved;
+        for (auto Index : SortFilesByIncludes())
+        {
+            if (isEmptyFile(Files[Index]))
+            {
+                RootRemoved << Fragments[Index].ssRemoved.str();
+                continue;
+            }
+            Group.push_back(Index);
+            if (Group.size() >= std::max<size_t>(FilesPerShard, 1))
+            {
+                Flush();
+            }
+        }
+        Flush();
 
+        std::stringstream ss;
+        ss << "#include <lua.hpp>\n#include <luaportal/luaportal.h>\n\n";
+        for (size_t i = 1; i < Result.size(); ++i)
+        {
+            ss << "void RegisterAPIs_" << Result[i].Name << "(luaportal::LuaState& LOL);\n"
+                << "void UnregisterStaticLuaProperties_" << Result[i].Name << "();\n";
+            if (!PreviousFiles.empty())
+            {
+                ss << "void RegisterAPIsDelta_" << Result[i].Name << "(luaportal::LuaState& LOL);\n";
+            }
+        }
+        ss << "\nvoid RegisterAPIs(luaportal::LuaState& LOL) \n{\n";
+        for (size_t i = 1; i < Result.size(); ++i)
+        {
+            ss << "\tRegisterAPIs_" << Result[i].Name << "(LOL);\n";
+        }
+        ss << "}\n\nvoid UnregisterStaticLuaProperties() \n{\n";
+        for (size_t i = 1; i < Result.size(); ++i)
+        {
+            ss << "\tUnregisterStaticLuaProperties_" << Result[i].Name << "();\n";
+        }
+        ss << "}\n";
+        if (!PreviousFiles.empty())
+        {
+            ss << "\nvoid RegisterAPIsDelta(luaportal::LuaState& LOL) \n{\n";
+            ComposeRemovedFiles(ss);
+            ss << RootRemoved.str();
+            for (size_t i = 1; i < Result.size(); ++i)
+            {
+                ss << "\tRegisterAPIsDelta_" << Result[i].Name << "(LOL);\n";
+            }
+            ss << "}\n";
+        }
+        Result[0].Code = ss.str();
+        return Result;
+    }
 
 };
 
@@ -765,13 +2440,55 @@ CodeGenerator::~CodeGenerator()
 
 bool CodeGenerator::ParseAST(const std::string& InputFile)
 {
-    impl->AutoNullMacro = AutoNullMacro;
-    impl->FunctionPropertyMacro = FunctionPropertyMacro;
-    impl->CFunctionMacro = CFunctionMacro;
-    return impl->ParseAST(InputFile);
+    impl->Options.AutoNullMacro = AutoNullMacro;
+    impl->Options.FunctionPropertyMacro = FunctionPropertyMacro;
+    impl->Options.CFunctionMacro = CFunctionMacro;
+    impl->Options.Streaming = (Loader == ASTLoader::Streaming);
+    return impl->ParseAST(InputFile, impl->Files);
+}
+
+bool CodeGenerator::ParsePreviousAST(const std::string& InputFile)
+{
+    impl->Options.AutoNullMacro = AutoNullMacro;
+    impl->Options.FunctionPropertyMacro = FunctionPropertyMacro;
+    impl->Options.CFunctionMacro = CFunctionMacro;
+    impl->Options.Streaming = (Loader == ASTLoader::Streaming);
+    return impl->ParseAST(InputFile, impl->PreviousFiles);
 }
 
 std::string CodeGenerator::GetResult()
 {
+    impl->Jobs = Jobs;
+    impl->Thunks = Thunks;
+    impl->Data = Data;
+    impl->Register = Register;
+    impl->Index = Index;
+    impl->Inherit = Inherit;
+    impl->Pointers = Pointers;
+    impl->Strings = Strings;
+    impl->Enums = Enums;
+    impl->Ffi = Ffi;
+    impl->Profile = Profile;
     return impl->GetResult();
 }
+
+std::vector<CodeGenerator::Shard> CodeGenerator::GetShardedResult(size_t FilesPerShard)
+{
+    impl->Jobs = Jobs;
+    impl->Thunks = Thunks;
+    impl->Data = Data;
+    impl->Register = Register;
+    impl->Index = Index;
+    impl->Inherit = Inherit;
+    impl->Pointers = Pointers;
+    impl->Strings = Strings;
+    impl->Enums = Enums;
+    impl->Ffi = Ffi;
+    impl->Profile = Profile;
+    return impl->GetShardedResult(FilesPerShard);
+}
+
+std::string CodeGenerator::GetFfiModule()
+{
+    return impl->GetFfiModule();
+}
\ No newline at end of file
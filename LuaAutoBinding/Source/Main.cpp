@@ -1,7 +1,21 @@
 #include "CodeGenerator.h"
+#include "Stats.h"
 
 #include <iostream>
 #include <fstream>
+#include <sstream>
+#include <set>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <regex>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <dirent.h>
+#endif
+#include <sys/stat.h>
 
 #include <tclap/CmdLine.h>
 using std::string;
@@ -11,14 +25,203 @@ using std::cout;
 using std::cerr;
 using std::endl;
 
+bool IsDirectory(const string& Path)
+{
+    struct stat Info;
+    return stat(Path.c_str(), &Info) == 0 && (Info.st_mode & S_IFDIR) != 0;
+}
+
+static void AddIfAst(const string& FileName, vector<string>& FileList)
+{
+    static std::regex JsonRegex(".*[.]json");
+    if (std::regex_match(FileName, JsonRegex))
+    {
+        FileList.push_back(FileName);
+    }
+}
+
+#ifdef _WIN32
+void DFSFolder(const string& path, vector<string>& FileList)
+{
+    _finddata_t file_info;
+    string current_path = path + "/*.*";
+    auto handle = _findfirst(current_path.c_str(), &file_info);
+    if (-1 == handle)
+    {
+        cerr << "cannot match the path " << path << endl;
+        return;
+    }
+
+    do
+    {
+        // Directories also carry read only, archive and other attribute bits
+        if ((file_info.attrib & _A_SUBDIR) != 0)
+        {
+            if (strcmp(file_info.name, "..") != 0 && strcmp(file_info.name, ".") != 0)
+            {
+                DFSFolder(path + '/' + file_info.name, FileList);
+            }
+        }
+        else
+        {
+            AddIfAst(path + "/" + file_info.name, FileList);
+        }
+    } while (!_findnext(handle, &file_info));
+
+    _findclose(handle);
+}
+#else
+void DFSFolder(const string& path, vector<string>& FileList)
+{
+    auto Dir = opendir(path.c_str());
+    if (!Dir)
+    {
+        cerr << "cannot match the path " << path << endl;
+        return;
+    }
+
+    while (auto Entry = readdir(Dir))
+    {
+        if (strcmp(Entry->d_name, "..") == 0 || strcmp(Entry->d_name, ".") == 0)
+        {
+            continue;
+        }
+        // d_type is not filled in by every file system, stat always tells
+        auto FileName = path + "/" + Entry->d_name;
+        if (IsDirectory(FileName))
+        {
+            DFSFolder(FileName, FileList);
+        }
+        else
+        {
+            AddIfAst(FileName, FileList);
+        }
+    }
+
+    closedir(Dir);
+}
+#endif
+
+// Expands directories into the asts they contain, in name order
+vector<string> CollectAstFiles(const vector<string>& Inputs)
+{
+    vector<string> AstFiles;
+    for (auto& Input : Inputs)
+    {
+        if (IsDirectory(Input))
+        {
+            vector<string> Found;
+            DFSFolder(Input, Found);
+            std::sort(Found.begin(), Found.end());
+            AstFiles.insert(AstFiles.end(), Found.begin(), Found.end());
+        }
+        else
+        {
+            AstFiles.push_back(Input);
+        }
+    }
+    return AstFiles;
+}
+
+// Leaves the file untouched when the content is the same, so its timestamp does not trigger a rebuild
+static bool WriteIfChanged(const string& Path, const string& Content)
+{
+    {
+        std::ifstream ifs(Path, std::ios::binary);
+        if (ifs.is_open())
+        {
+            std::stringstream Existing;
+            Existing << ifs.rdbuf();
+            if (Existing.str() == Content)
+            {
+                return true;
+            }
+        }
+    }
+    std::ofstream ofs(Path, std::ios::binary);
+    if (!ofs.is_open())
+    {
+        cerr << "Could not write " << Path << endl;
+        return false;
+    }
+    ofs << Content;
+    return true;
+}
+
+// Writes the root unit to OutputFile and every shard next to it as <stem>_<shard><ext>.
+// The shard file names are listed in OutputFile.shards, shards named there by a previous run and no longer produced are removed.
+static bool WriteShards(const string& OutputFile, const vector<CodeGenerator::Shard>& Shards, const string& PreInclude)
+{
+    auto Slash = OutputFile.find_last_of("/\\");
+    auto Dot = OutputFile.find_last_of('.');
+    if (Dot == string::npos || (Slash != string::npos && Dot < Slash))
+    {
+        Dot = OutputFile.size();
+    }
+    auto Stem = OutputFile.substr(0, Dot);
+    auto Extension = OutputFile.substr(Dot);
+    auto Directory = (Slash == string::npos) ? string() : OutputFile.substr(0, Slash + 1);
+
+    auto ManifestFile = OutputFile + ".shards";
+    std::set<string> OldShards;
+    {
+        std::ifstream ifs(ManifestFile);
+        string Line;
+        while (std::getline(ifs, Line))
+        {
+            if (!Line.empty())
+            {
+                OldShards.insert(Line);
+            }
+        }
+    }
+
+    std::stringstream Manifest;
+    for (auto& Item : Shards)
+    {
+        auto Path = Item.Name.empty() ? OutputFile : Stem + "_" + Item.Name + Extension;
+        if (!WriteIfChanged(Path, PreInclude + Item.Code))
+        {
+            return false;
+        }
+        if (!Item.Name.empty())
+        {
+            auto FileName = Path.substr(Directory.size());
+            Manifest << FileName << "\n";
+            OldShards.erase(FileName);
+        }
+    }
+    for (auto& Stale : OldShards)
+    {
+        std::remove((Directory + Stale).c_str());
+    }
+    return WriteIfChanged(ManifestFile, Manifest.str());
+}
+
 int main(int argc, const char** argv)
 {
-    string InputFile;
+    vector<string> InputFiles;
+    vector<string> PreviousFiles;
     string OutputFile;
     vector<string> PreIncludeList;
     string AutoNullMacro;
     string FunctionPropertyMacro;
     string CFunctionMacro;
+    bool PrintStats;
+    string TraceFile;
+    string Loader;
+    int FilesPerShard;
+    unsigned Jobs;
+    string Thunks;
+    string Data;
+    string Register;
+    string Index;
+    string Inherit;
+    string Pointers;
+    string Strings;
+    string Enums;
+    string FfiFile;
+    string Profile;
     try
     {
         using namespace TCLAP;
@@ -30,16 +233,48 @@ int main(int argc, const char** argv)
         ValueArg<string> AutoNullMacroArg("a", "autonullmacro", "Generate set data nullptr code.", false, "", "", cmd);
         ValueArg<string> FunctionPropertyMacroArg("f", "functionpropertymacro", "Mark function as property.", false, "", "", cmd);
         ValueArg<string> CFunctionMacroArg("c", "cfunctionmacro", "Mark function as lua_cfunction.", false, "", "", cmd);
-        UnlabeledValueArg<string> InputFileArg("InputFile", "Input json ast file.", true, "", "", cmd);
+        ValueArg<string> LoaderArg("l", "loader", "How to load the ast: sax streams it into the model, dom parses a json document first.", false, "sax", "", cmd);
+        ValueArg<int> ShardArg("s", "shard", "Write one translation unit per N headers next to the output file, the output file then only calls them. 0 writes everything into the output file.", false, 0, "N", cmd);
+        ValueArg<unsigned> JobsArg("j", "jobs", "Threads used to generate code, 0 uses one per hardware thread. The output is the same for any count.", false, 0, "N", cmd);
+        MultiArg<string> PreviousArg("d", "previous", "Ast files or directories the running process was generated from. Adds RegisterAPIsDelta, which only registers what changed since then.", false, "", cmd);
+        ValueArg<string> ThunksArg("t", "thunks", "portal binds every function through the luaportal chain, shared binds them through one lab/Thunk.h thunk per function type, direct generates a lua_CFunction per function, table also does for properties and installs them from per class luaL_Reg arrays.", false, "portal", "", cmd);
+        ValueArg<string> DataArg("", "data", "portal binds every data member through the luaportal chain, offset binds members of plain types through per class lab/Field.h offset tables.", false, "portal", "", cmd);
+        ValueArg<string> RegisterArg("r", "register", "eager builds every binding in RegisterAPIs, lazy builds each top level namespace on its first use through lab/Module.h.", false, "eager", "", cmd);
+        ValueArg<string> IndexArg("", "index", "portal looks members up through luaportal, hash puts a per class perfect hash over the members in front of it. hash needs --thunks table and cannot be used with --previous.", false, "portal", "", cmd);
+        ValueArg<string> InheritArg("", "inherit", "chain looks inherited members up through the parent classes, flatten copies them into every derived class at registration.", false, "chain", "", cmd);
+        ValueArg<string> PointersArg("", "pointers", "new pushes every returned pointer as a new userdata, cached reuses the userdata of an object lua still references through lab/Identity.h. cached needs --thunks direct or table.", false, "new", "", cmd);
+        ValueArg<string> StringsArg("", "strings", "copy builds a std::string for every const std::string& argument, reuse fills buffers lab/Direct.h keeps per thread. reuse needs --thunks direct or table.", false, "copy", "", cmd);
+        ValueArg<string> EnumsArg("", "enums", "portal builds enums through the luaportal chain, sized creates each enum table at its final size and fills it at once through lab/Enum.h.", false, "portal", "", cmd);
+        ValueArg<string> FfiArg("", "ffi", "Also give every function of plain value types an extern \"C\" shim and write the LuaJIT module calling them through ffi.cdef to this path.", false, "", "path", cmd);
+        ValueArg<string> ProfileArg("", "profile", "off generates no instrumentation, calls makes every generated thunk count its calls and time one in LAB_PROFILE_SAMPLE (64) into a total, longest time and latency histogram through lab/Profile.h, readable from C++ and from lua through __bindingstats(). Build with LAB_PROFILE=0 to compile the counting out. calls needs --thunks direct or table.", false, "off", "", cmd);
+        SwitchArg StatsArg("", "stats", "Print time spent per phase, per file counters and peak memory to stderr", cmd, false);
+        ValueArg<string> TraceArg("", "trace", "Write phase spans to a chrome trace-event json file", false, "", "", cmd);
+        UnlabeledMultiArg<string> InputFileArg("InputFile", "Input json ast files, or directories searched for *.json. Headers found in several asts are generated once.", true, "", cmd);
         
 
         cmd.parse(argc, argv);
-        InputFile = InputFileArg.getValue();
+        InputFiles = InputFileArg.getValue();
+        PreviousFiles = PreviousArg.getValue();
         OutputFile = OutputFileArg.getValue();
         PreIncludeList = PreIncludeListArg.getValue();
         AutoNullMacro = AutoNullMacroArg.getValue();
         FunctionPropertyMacro = FunctionPropertyMacroArg.getValue();
         CFunctionMacro = CFunctionMacroArg.getValue();
+        Loader = LoaderArg.getValue();
+        PrintStats = StatsArg.getValue();
+        TraceFile = TraceArg.getValue();
+        FilesPerShard = ShardArg.getValue();
+        Jobs = JobsArg.getValue();
+        Thunks = ThunksArg.getValue();
+        Data = DataArg.getValue();
+        Register = RegisterArg.getValue();
+        Index = IndexArg.getValue();
+        Inherit = InheritArg.getValue();
+        Pointers = PointersArg.getValue();
+        Strings = StringsArg.getValue();
+        Enums = EnumsArg.getValue();
+        FfiFile = FfiArg.getValue();
+        Profile = ProfileArg.getValue();
     }
     catch (TCLAP::ArgException& e)
     {
@@ -47,16 +282,162 @@ int main(int argc, const char** argv)
         return -1;
     }
 
+    if (Loader != "sax" && Loader != "dom")
+    {
+        cerr << "error: unknown loader " << Loader << endl;
+        return -1;
+    }
+
+    if (Thunks != "portal" && Thunks != "shared" && Thunks != "direct" && Thunks != "table")
+    {
+        cerr << "error: unknown thunk mode " << Thunks << endl;
+        return -1;
+    }
+
+    if (Data != "portal" && Data != "offset")
+    {
+        cerr << "error: unknown data mode " << Data << endl;
+        return -1;
+    }
+
+    if (Register != "eager" && Register != "lazy")
+    {
+        cerr << "error: unknown register mode " << Register << endl;
+        return -1;
+    }
+
+    if (Index != "portal" && Index != "hash")
+    {
+        cerr << "error: unknown index mode " << Index << endl;
+        return -1;
+    }
+
+    if (Index == "hash" && Thunks != "table")
+    {
+        cerr << "error: --index hash needs --thunks table" << endl;
+        return -1;
+    }
+
+    // The hash tables are static arrays built by RegisterAPIs, a delta would leave them dispatching removed or changed members
+    if (Index == "hash" && !PreviousFiles.empty())
+    {
+        cerr << "error: --index hash cannot be used with --previous" << endl;
+        return -1;
+    }
+
+    if (Inherit != "chain" && Inherit != "flatten")
+    {
+        cerr << "error: unknown inherit mode " << Inherit << endl;
+        return -1;
+    }
+
+    if (Pointers != "new" && Pointers != "cached")
+    {
+        cerr << "error: unknown pointers mode " << Pointers << endl;
+        return -1;
+    }
+
+    if (Pointers == "cached" && Thunks != "direct" && Thunks != "table")
+    {
+        cerr << "error: --pointers cached needs --thunks direct or table" << endl;
+        return -1;
+    }
+
+    if (Strings != "copy" && Strings != "reuse")
+    {
+        cerr << "error: unknown strings mode " << Strings << endl;
+        return -1;
+    }
+
+    if (Strings == "reuse" && Thunks != "direct" && Thunks != "table")
+    {
+        cerr << "error: --strings reuse needs --thunks direct or table" << endl;
+        return -1;
+    }
+
+    if (Enums != "portal" && Enums != "sized")
+    {
+        cerr << "error: unknown enums mode " << Enums << endl;
+        return -1;
+    }
+
+    if (Profile != "off" && Profile != "calls")
+    {
+        cerr << "error: unknown profile mode " << Profile << endl;
+        return -1;
+    }
+
+    if (Profile == "calls" && Thunks != "direct" && Thunks != "table")
+    {
+        cerr << "error: --profile calls needs --thunks direct or table" << endl;
+        return -1;
+    }
+
+    if (FilesPerShard < 0 || (FilesPerShard > 0 && OutputFile.empty()))
+    {
+        cerr << "error: --shard needs a positive header count and an output file" << endl;
+        return -1;
+    }
+
+    stats::Enable("lab", PrintStats, TraceFile);
 
     CodeGenerator cg;
     cg.AutoNullMacro = AutoNullMacro;
     cg.FunctionPropertyMacro = FunctionPropertyMacro;
     cg.CFunctionMacro = CFunctionMacro;
-    if (cg.ParseAST(InputFile))
+    cg.Jobs = Jobs;
+    cg.Data = (Data == "offset") ? CodeGenerator::DataMode::Offset : CodeGenerator::DataMode::Portal;
+    cg.Pointers = (Pointers == "cached") ? CodeGenerator::PointerMode::Cached : CodeGenerator::PointerMode::New;
+    cg.Profile = (Profile == "calls") ? CodeGenerator::ProfileMode::Calls : CodeGenerator::ProfileMode::Off;
+    cg.Ffi = FfiFile.empty() ? CodeGenerator::FfiMode::Off : CodeGenerator::FfiMode::Shims;
+    cg.Enums = (Enums == "sized") ? CodeGenerator::EnumMode::Sized : CodeGenerator::EnumMode::Portal;
+    cg.Strings = (Strings == "reuse") ? CodeGenerator::StringMode::Reuse : CodeGenerator::StringMode::Copy;
+    cg.Inherit = (Inherit == "flatten") ? CodeGenerator::InheritMode::Flatten : CodeGenerator::InheritMode::Chain;
+    cg.Index = (Index == "hash") ? CodeGenerator::IndexMode::Hash : CodeGenerator::IndexMode::Portal;
+    cg.Register = (Register == "lazy") ? CodeGenerator::RegisterMode::Lazy : CodeGenerator::RegisterMode::Eager;
+    cg.Thunks = (Thunks == "shared") ? CodeGenerator::ThunkMode::Shared
+        : (Thunks == "direct") ? CodeGenerator::ThunkMode::Direct
+        : (Thunks == "table") ? CodeGenerator::ThunkMode::Table
+        : CodeGenerator::ThunkMode::Portal;
+    cg.Loader = (Loader == "dom") ? CodeGenerator::ASTLoader::Document : CodeGenerator::ASTLoader::Streaming;
+    for (auto& AstFile : CollectAstFiles(InputFiles))
+    {
+        if (!cg.ParseAST(AstFile))
+        {
+            return 1;
+        }
+    }
+    for (auto& AstFile : CollectAstFiles(PreviousFiles))
+    {
+        if (!cg.ParsePreviousAST(AstFile))
+        {
+            return 1;
+        }
+    }
+
+    if (FilesPerShard > 0)
+    {
+        auto Shards = cg.GetShardedResult(FilesPerShard);
+        string PreInclude;
+        for (auto& Include : PreIncludeList)
+        {
+            PreInclude += Include + "\n";
+        }
+        stats::ScopedSpan Span("write", OutputFile);
+        Span.Counter("shards", Shards.size() - 1);
+        if (!WriteShards(OutputFile, Shards, PreInclude))
+        {
+            return -1;
+        }
+    }
+    else
     {
+        auto Result = cg.GetResult();
+        stats::ScopedSpan Span("write", OutputFile.empty() ? "stdout" : OutputFile);
+        Span.Counter("bytes", Result.size());
         if (OutputFile.empty())
         {
-            cout << cg.GetResult() << endl;
+            cout << Result << endl;
         }
         else
         {
@@ -72,13 +453,19 @@ int main(int argc, const char** argv)
                 ofs << Include << endl;
             }
 
-            ofs << cg.GetResult();
+            ofs << Result;
             ofs.close();
         }
     }
-    else
+
+    if (!FfiFile.empty() && !WriteIfChanged(FfiFile, cg.GetFfiModule()))
     {
-        return 1;
+        return -1;
+    }
+
+    if (!stats::Finish())
+    {
+        return -1;
     }
     
     return 0;
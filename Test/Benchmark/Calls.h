@@ -0,0 +1,165 @@
+#pragma once
+
+#include <lua.hpp>
+#include <luaexport>
+
+#include <string>
+
+// What the call benchmark crosses into. Every function does as little as the compiler lets it, so a case measures
+// the binding and not the work behind it.
+LUA_NAMESPACE(name = bench)
+namespace bench
+{
+    LUA_FUNCTION()
+    inline int Add(int A, int B)
+    {
+        return A + B;
+    }
+
+    // A new std::string per call unless the bindings reuse buffers, --strings reuse
+    LUA_FUNCTION()
+    inline int Length(const std::string& Text)
+    {
+        return static_cast<int>(Text.size());
+    }
+
+    LUA_CLASS()
+    class Counter
+    {
+    public:
+        LUA_CTOR()
+        Counter()
+        {
+        }
+
+        virtual ~Counter()
+        {
+        }
+
+        LUA_FUNCTION()
+        static int Twice(int A)
+        {
+            return A * 2;
+        }
+
+        LUA_FUNCTION()
+        int Arg0()
+        {
+            return ++Total;
+        }
+
+        LUA_FUNCTION()
+        int Arg1(int A)
+        {
+            return Total = A;
+        }
+
+        LUA_FUNCTION()
+        int Arg2(int A, int B)
+        {
+            return Total = A + B;
+        }
+
+        LUA_FUNCTION()
+        int Arg3(int A, int B, int C)
+        {
+            return Total = A + B + C;
+        }
+
+        LUA_FUNCTION()
+        int Arg4(int A, int B, int C, int D)
+        {
+            return Total = A + B + C + D;
+        }
+
+        LUA_FUNCTION()
+        int Arg5(int A, int B, int C, int D, int E)
+        {
+            return Total = A + B + C + D + E;
+        }
+
+        LUA_FUNCTION()
+        int Arg6(int A, int B, int C, int D, int E, int F)
+        {
+            return Total = A + B + C + D + E + F;
+        }
+
+        LUA_FUNCTION()
+        int Arg7(int A, int B, int C, int D, int E, int F, int G)
+        {
+            return Total = A + B + C + D + E + F + G;
+        }
+
+        LUA_FUNCTION()
+        int Arg8(int A, int B, int C, int D, int E, int F, int G, int H)
+        {
+            return Total = A + B + C + D + E + F + G + H;
+        }
+
+        LUA_PROPERTY(name = Value, setter = SetValue)
+        int GetValue() const
+        {
+            return Total;
+        }
+
+        void SetValue(int A)
+        {
+            Total = A;
+        }
+
+        // Pushes the object back, a new userdata for every call unless pointers are cached
+        LUA_FUNCTION()
+        Counter* Self()
+        {
+            return this;
+        }
+
+        // Pushes a new object, a new userdata for every call in every mode
+        LUA_FUNCTION()
+        Counter Copy() const
+        {
+            return *this;
+        }
+
+        LUA_CFUNCTION()
+        static int Raw(lua_State* L)
+        {
+            lua_pushinteger(L, 1);
+            return 1;
+        }
+
+        LUA_DATA()
+        int Data = 0;
+
+    private:
+        int Total = 0;
+    };
+
+    LUA_CLASS()
+    class Middle : public bench::Counter
+    {
+    public:
+        LUA_FUNCTION()
+        int Depth() const
+        {
+            return 1;
+        }
+    };
+
+    // Calls Counter's methods through two parent classes
+    LUA_CLASS()
+    class Leaf : public bench::Middle
+    {
+    public:
+        LUA_CTOR()
+        Leaf()
+        {
+        }
+
+        LUA_FUNCTION()
+        int Height() const
+        {
+            return 2;
+        }
+    };
+}
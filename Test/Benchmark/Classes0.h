@@ -0,0 +1,90 @@
+#pragma once
+
+#include <luaexport>
+
+// Classes the registration case binds. They only add to the number of classes and members a state registers. The
+// sweep registers Calls.h and then Classes0.h to Classes4.h in order, each as many shapes as all before it, so the
+// shapes bound double from 4 to 64.
+LUA_NAMESPACE(name = shapes)
+namespace shapes
+{
+    LUA_CLASS()
+    class Shape0
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape1
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape2
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape3
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+}
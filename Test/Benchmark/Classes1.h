@@ -0,0 +1,88 @@
+#pragma once
+
+#include <luaexport>
+
+// Shape4 to Shape7 of the registration sweep, see Classes0.h
+LUA_NAMESPACE(name = shapes)
+namespace shapes
+{
+    LUA_CLASS()
+    class Shape4
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape5
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape6
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape7
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+}
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <luaexport>
+
+// Shape8 to Shape15 of the registration sweep, see Classes0.h
+LUA_NAMESPACE(name = shapes)
+namespace shapes
+{
+    LUA_CLASS()
+    class Shape8
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape9
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape10
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape11
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape12
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape13
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape14
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape15
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+}
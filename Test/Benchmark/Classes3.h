@@ -0,0 +1,328 @@
+#pragma once
+
+#include <luaexport>
+
+// Shape16 to Shape31 of the registration sweep, see Classes0.h
+LUA_NAMESPACE(name = shapes)
+namespace shapes
+{
+    LUA_CLASS()
+    class Shape16
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape17
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape18
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape19
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape20
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape21
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape22
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape23
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape24
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape25
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape26
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape27
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape28
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape29
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape30
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape31
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+}
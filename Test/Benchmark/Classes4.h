@@ -0,0 +1,648 @@
+#pragma once
+
+#include <luaexport>
+
+// Shape32 to Shape63 of the registration sweep, see Classes0.h
+LUA_NAMESPACE(name = shapes)
+namespace shapes
+{
+    LUA_CLASS()
+    class Shape32
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape33
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape34
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape35
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape36
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape37
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape38
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape39
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape40
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape41
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape42
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape43
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape44
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape45
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape46
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape47
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape48
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape49
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape50
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape51
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape52
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape53
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape54
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape55
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape56
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape57
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape58
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape59
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape60
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape61
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape62
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+
+    LUA_CLASS()
+    class Shape63
+    {
+    public:
+        LUA_FUNCTION()
+        int Get() const
+        {
+            return Value;
+        }
+
+        LUA_FUNCTION()
+        void Set(int A)
+        {
+            Value = A;
+        }
+
+        LUA_DATA()
+        int Value = 0;
+    };
+}
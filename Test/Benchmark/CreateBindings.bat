@@ -0,0 +1,15 @@
+@echo off
+
+rem tuned is every lab option that trades generated code for a cheaper crossing, profiled is table with call counters.
+rem Strings.h is only bound by the modes that generate thunks, luaportal does not read std::string_view.
+rem -s 1 writes a Generated_<mode>_<header>.cpp per header, which the registration sweep of Main.cpp calls one by one.
+hp.exe  -c LUA_CLASS -e LUA_ENUM -t LUA_CTOR -f LUA_FUNCTION -f LUA_PROPERTY -f LUA_CFUNCTION -p LUA_DATA -p LUA_CALLBACK -n LUA_NAMESPACE -o ast.json -- Calls.h Classes0.h Classes1.h Classes2.h Classes3.h Classes4.h
+hp.exe  -c LUA_CLASS -e LUA_ENUM -t LUA_CTOR -f LUA_FUNCTION -f LUA_PROPERTY -f LUA_CFUNCTION -p LUA_DATA -p LUA_CALLBACK -n LUA_NAMESPACE -o ast_strings.json -- Strings.h
+lab.exe -a LUA_CALLBACK -f LUA_PROPERTY -c LUA_CFUNCTION -s 1 -o Generated_portal.cpp -- ast.json
+lab.exe -a LUA_CALLBACK -f LUA_PROPERTY -c LUA_CFUNCTION -s 1 -t shared -o Generated_shared.cpp -- ast.json
+lab.exe -a LUA_CALLBACK -f LUA_PROPERTY -c LUA_CFUNCTION -s 1 -t direct -o Generated_direct.cpp -- ast.json ast_strings.json
+lab.exe -a LUA_CALLBACK -f LUA_PROPERTY -c LUA_CFUNCTION -s 1 -t table -o Generated_table.cpp -- ast.json ast_strings.json
+lab.exe -a LUA_CALLBACK -f LUA_PROPERTY -c LUA_CFUNCTION -s 1 -t table --data offset --index hash --inherit flatten --pointers cached --strings reuse --enums sized -o Generated_tuned.cpp -- ast.json ast_strings.json
+lab.exe -a LUA_CALLBACK -f LUA_PROPERTY -c LUA_CFUNCTION -s 1 -t table --profile calls -o Generated_profiled.cpp -- ast.json ast_strings.json
+
+pause
\ No newline at end of file
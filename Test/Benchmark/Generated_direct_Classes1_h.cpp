@@ -0,0 +1,93 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+#include <lab/Direct.h>
+#include "Classes1.h"
+
+static int Thunk_Classes1_h_shapes__Shape4__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape4>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes1_h_shapes__Shape4__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape4>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes1_h_shapes__Shape5__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape5>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes1_h_shapes__Shape5__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape5>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes1_h_shapes__Shape6__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape6>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes1_h_shapes__Shape6__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape6>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes1_h_shapes__Shape7__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape7>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes1_h_shapes__Shape7__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape7>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+void RegisterAPIs_Classes1_h(luaportal::LuaState& LOL) 
+{
+	LOL.GlobalContext()
+	.BeginNamespace("shapes")
+	.BeginClass<shapes::Shape4>("Shape4")
+	.AddData("Value", &shapes::Shape4::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape5>("Shape5")
+	.AddData("Value", &shapes::Shape5::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape6>("Shape6")
+	.AddData("Value", &shapes::Shape6::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape7>("Shape7")
+	.AddData("Value", &shapes::Shape7::Value, true)
+	.EndClass()
+	.EndNamespace()
+	;
+	lua_State* L = lab::portal::GetState(LOL);
+	lab::BindCMethod<shapes::Shape4>(L, "Get", &Thunk_Classes1_h_shapes__Shape4__Get, true);
+	lab::BindCMethod<shapes::Shape4>(L, "Set", &Thunk_Classes1_h_shapes__Shape4__Set, false);
+	lab::BindCMethod<shapes::Shape5>(L, "Get", &Thunk_Classes1_h_shapes__Shape5__Get, true);
+	lab::BindCMethod<shapes::Shape5>(L, "Set", &Thunk_Classes1_h_shapes__Shape5__Set, false);
+	lab::BindCMethod<shapes::Shape6>(L, "Get", &Thunk_Classes1_h_shapes__Shape6__Get, true);
+	lab::BindCMethod<shapes::Shape6>(L, "Set", &Thunk_Classes1_h_shapes__Shape6__Set, false);
+	lab::BindCMethod<shapes::Shape7>(L, "Get", &Thunk_Classes1_h_shapes__Shape7__Get, true);
+	lab::BindCMethod<shapes::Shape7>(L, "Set", &Thunk_Classes1_h_shapes__Shape7__Set, false);
+}
+
+void UnregisterStaticLuaProperties_Classes1_h() 
+{
+}
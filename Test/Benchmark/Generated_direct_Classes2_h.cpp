@@ -0,0 +1,169 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+#include <lab/Direct.h>
+#include "Classes2.h"
+
+static int Thunk_Classes2_h_shapes__Shape8__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape8>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape8__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape8>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes2_h_shapes__Shape9__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape9>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape9__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape9>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes2_h_shapes__Shape10__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape10>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape10__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape10>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes2_h_shapes__Shape11__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape11>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape11__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape11>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes2_h_shapes__Shape12__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape12>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape12__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape12>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes2_h_shapes__Shape13__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape13>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape13__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape13>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes2_h_shapes__Shape14__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape14>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape14__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape14>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes2_h_shapes__Shape15__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape15>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape15__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape15>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+void RegisterAPIs_Classes2_h(luaportal::LuaState& LOL) 
+{
+	LOL.GlobalContext()
+	.BeginNamespace("shapes")
+	.BeginClass<shapes::Shape8>("Shape8")
+	.AddData("Value", &shapes::Shape8::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape9>("Shape9")
+	.AddData("Value", &shapes::Shape9::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape10>("Shape10")
+	.AddData("Value", &shapes::Shape10::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape11>("Shape11")
+	.AddData("Value", &shapes::Shape11::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape12>("Shape12")
+	.AddData("Value", &shapes::Shape12::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape13>("Shape13")
+	.AddData("Value", &shapes::Shape13::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape14>("Shape14")
+	.AddData("Value", &shapes::Shape14::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape15>("Shape15")
+	.AddData("Value", &shapes::Shape15::Value, true)
+	.EndClass()
+	.EndNamespace()
+	;
+	lua_State* L = lab::portal::GetState(LOL);
+	lab::BindCMethod<shapes::Shape8>(L, "Get", &Thunk_Classes2_h_shapes__Shape8__Get, true);
+	lab::BindCMethod<shapes::Shape8>(L, "Set", &Thunk_Classes2_h_shapes__Shape8__Set, false);
+	lab::BindCMethod<shapes::Shape9>(L, "Get", &Thunk_Classes2_h_shapes__Shape9__Get, true);
+	lab::BindCMethod<shapes::Shape9>(L, "Set", &Thunk_Classes2_h_shapes__Shape9__Set, false);
+	lab::BindCMethod<shapes::Shape10>(L, "Get", &Thunk_Classes2_h_shapes__Shape10__Get, true);
+	lab::BindCMethod<shapes::Shape10>(L, "Set", &Thunk_Classes2_h_shapes__Shape10__Set, false);
+	lab::BindCMethod<shapes::Shape11>(L, "Get", &Thunk_Classes2_h_shapes__Shape11__Get, true);
+	lab::BindCMethod<shapes::Shape11>(L, "Set", &Thunk_Classes2_h_shapes__Shape11__Set, false);
+	lab::BindCMethod<shapes::Shape12>(L, "Get", &Thunk_Classes2_h_shapes__Shape12__Get, true);
+	lab::BindCMethod<shapes::Shape12>(L, "Set", &Thunk_Classes2_h_shapes__Shape12__Set, false);
+	lab::BindCMethod<shapes::Shape13>(L, "Get", &Thunk_Classes2_h_shapes__Shape13__Get, true);
+	lab::BindCMethod<shapes::Shape13>(L, "Set", &Thunk_Classes2_h_shapes__Shape13__Set, false);
+	lab::BindCMethod<shapes::Shape14>(L, "Get", &Thunk_Classes2_h_shapes__Shape14__Get, true);
+	lab::BindCMethod<shapes::Shape14>(L, "Set", &Thunk_Classes2_h_shapes__Shape14__Set, false);
+	lab::BindCMethod<shapes::Shape15>(L, "Get", &Thunk_Classes2_h_shapes__Shape15__Get, true);
+	lab::BindCMethod<shapes::Shape15>(L, "Set", &Thunk_Classes2_h_shapes__Shape15__Set, false);
+}
+
+void UnregisterStaticLuaProperties_Classes2_h() 
+{
+}
@@ -0,0 +1,625 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+#include <lab/Direct.h>
+#include "Classes4.h"
+
+static int Thunk_Classes4_h_shapes__Shape32__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape32>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape32__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape32>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape33__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape33>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape33__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape33>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape34__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape34>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape34__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape34>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape35__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape35>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape35__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape35>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape36__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape36>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape36__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape36>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape37__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape37>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape37__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape37>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape38__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape38>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape38__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape38>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape39__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape39>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape39__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape39>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape40__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape40>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape40__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape40>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape41__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape41>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape41__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape41>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape42__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape42>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape42__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape42>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape43__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape43>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape43__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape43>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape44__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape44>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape44__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape44>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape45__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape45>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape45__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape45>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape46__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape46>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape46__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape46>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape47__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape47>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape47__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape47>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape48__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape48>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape48__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape48>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape49__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape49>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape49__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape49>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape50__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape50>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape50__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape50>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape51__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape51>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape51__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape51>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape52__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape52>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape52__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape52>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape53__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape53>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape53__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape53>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape54__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape54>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape54__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape54>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape55__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape55>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape55__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape55>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape56__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape56>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape56__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape56>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape57__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape57>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape57__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape57>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape58__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape58>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape58__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape58>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape59__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape59>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape59__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape59>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape60__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape60>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape60__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape60>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape61__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape61>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape61__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape61>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape62__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape62>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape62__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape62>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape63__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape63>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape63__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape63>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+void RegisterAPIs_Classes4_h(luaportal::LuaState& LOL) 
+{
+	LOL.GlobalContext()
+	.BeginNamespace("shapes")
+	.BeginClass<shapes::Shape32>("Shape32")
+	.AddData("Value", &shapes::Shape32::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape33>("Shape33")
+	.AddData("Value", &shapes::Shape33::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape34>("Shape34")
+	.AddData("Value", &shapes::Shape34::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape35>("Shape35")
+	.AddData("Value", &shapes::Shape35::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape36>("Shape36")
+	.AddData("Value", &shapes::Shape36::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape37>("Shape37")
+	.AddData("Value", &shapes::Shape37::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape38>("Shape38")
+	.AddData("Value", &shapes::Shape38::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape39>("Shape39")
+	.AddData("Value", &shapes::Shape39::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape40>("Shape40")
+	.AddData("Value", &shapes::Shape40::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape41>("Shape41")
+	.AddData("Value", &shapes::Shape41::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape42>("Shape42")
+	.AddData("Value", &shapes::Shape42::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape43>("Shape43")
+	.AddData("Value", &shapes::Shape43::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape44>("Shape44")
+	.AddData("Value", &shapes::Shape44::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape45>("Shape45")
+	.AddData("Value", &shapes::Shape45::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape46>("Shape46")
+	.AddData("Value", &shapes::Shape46::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape47>("Shape47")
+	.AddData("Value", &shapes::Shape47::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape48>("Shape48")
+	.AddData("Value", &shapes::Shape48::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape49>("Shape49")
+	.AddData("Value", &shapes::Shape49::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape50>("Shape50")
+	.AddData("Value", &shapes::Shape50::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape51>("Shape51")
+	.AddData("Value", &shapes::Shape51::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape52>("Shape52")
+	.AddData("Value", &shapes::Shape52::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape53>("Shape53")
+	.AddData("Value", &shapes::Shape53::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape54>("Shape54")
+	.AddData("Value", &shapes::Shape54::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape55>("Shape55")
+	.AddData("Value", &shapes::Shape55::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape56>("Shape56")
+	.AddData("Value", &shapes::Shape56::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape57>("Shape57")
+	.AddData("Value", &shapes::Shape57::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape58>("Shape58")
+	.AddData("Value", &shapes::Shape58::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape59>("Shape59")
+	.AddData("Value", &shapes::Shape59::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape60>("Shape60")
+	.AddData("Value", &shapes::Shape60::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape61>("Shape61")
+	.AddData("Value", &shapes::Shape61::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape62>("Shape62")
+	.AddData("Value", &shapes::Shape62::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape63>("Shape63")
+	.AddData("Value", &shapes::Shape63::Value, true)
+	.EndClass()
+	.EndNamespace()
+	;
+	lua_State* L = lab::portal::GetState(LOL);
+	lab::BindCMethod<shapes::Shape32>(L, "Get", &Thunk_Classes4_h_shapes__Shape32__Get, true);
+	lab::BindCMethod<shapes::Shape32>(L, "Set", &Thunk_Classes4_h_shapes__Shape32__Set, false);
+	lab::BindCMethod<shapes::Shape33>(L, "Get", &Thunk_Classes4_h_shapes__Shape33__Get, true);
+	lab::BindCMethod<shapes::Shape33>(L, "Set", &Thunk_Classes4_h_shapes__Shape33__Set, false);
+	lab::BindCMethod<shapes::Shape34>(L, "Get", &Thunk_Classes4_h_shapes__Shape34__Get, true);
+	lab::BindCMethod<shapes::Shape34>(L, "Set", &Thunk_Classes4_h_shapes__Shape34__Set, false);
+	lab::BindCMethod<shapes::Shape35>(L, "Get", &Thunk_Classes4_h_shapes__Shape35__Get, true);
+	lab::BindCMethod<shapes::Shape35>(L, "Set", &Thunk_Classes4_h_shapes__Shape35__Set, false);
+	lab::BindCMethod<shapes::Shape36>(L, "Get", &Thunk_Classes4_h_shapes__Shape36__Get, true);
+	lab::BindCMethod<shapes::Shape36>(L, "Set", &Thunk_Classes4_h_shapes__Shape36__Set, false);
+	lab::BindCMethod<shapes::Shape37>(L, "Get", &Thunk_Classes4_h_shapes__Shape37__Get, true);
+	lab::BindCMethod<shapes::Shape37>(L, "Set", &Thunk_Classes4_h_shapes__Shape37__Set, false);
+	lab::BindCMethod<shapes::Shape38>(L, "Get", &Thunk_Classes4_h_shapes__Shape38__Get, true);
+	lab::BindCMethod<shapes::Shape38>(L, "Set", &Thunk_Classes4_h_shapes__Shape38__Set, false);
+	lab::BindCMethod<shapes::Shape39>(L, "Get", &Thunk_Classes4_h_shapes__Shape39__Get, true);
+	lab::BindCMethod<shapes::Shape39>(L, "Set", &Thunk_Classes4_h_shapes__Shape39__Set, false);
+	lab::BindCMethod<shapes::Shape40>(L, "Get", &Thunk_Classes4_h_shapes__Shape40__Get, true);
+	lab::BindCMethod<shapes::Shape40>(L, "Set", &Thunk_Classes4_h_shapes__Shape40__Set, false);
+	lab::BindCMethod<shapes::Shape41>(L, "Get", &Thunk_Classes4_h_shapes__Shape41__Get, true);
+	lab::BindCMethod<shapes::Shape41>(L, "Set", &Thunk_Classes4_h_shapes__Shape41__Set, false);
+	lab::BindCMethod<shapes::Shape42>(L, "Get", &Thunk_Classes4_h_shapes__Shape42__Get, true);
+	lab::BindCMethod<shapes::Shape42>(L, "Set", &Thunk_Classes4_h_shapes__Shape42__Set, false);
+	lab::BindCMethod<shapes::Shape43>(L, "Get", &Thunk_Classes4_h_shapes__Shape43__Get, true);
+	lab::BindCMethod<shapes::Shape43>(L, "Set", &Thunk_Classes4_h_shapes__Shape43__Set, false);
+	lab::BindCMethod<shapes::Shape44>(L, "Get", &Thunk_Classes4_h_shapes__Shape44__Get, true);
+	lab::BindCMethod<shapes::Shape44>(L, "Set", &Thunk_Classes4_h_shapes__Shape44__Set, false);
+	lab::BindCMethod<shapes::Shape45>(L, "Get", &Thunk_Classes4_h_shapes__Shape45__Get, true);
+	lab::BindCMethod<shapes::Shape45>(L, "Set", &Thunk_Classes4_h_shapes__Shape45__Set, false);
+	lab::BindCMethod<shapes::Shape46>(L, "Get", &Thunk_Classes4_h_shapes__Shape46__Get, true);
+	lab::BindCMethod<shapes::Shape46>(L, "Set", &Thunk_Classes4_h_shapes__Shape46__Set, false);
+	lab::BindCMethod<shapes::Shape47>(L, "Get", &Thunk_Classes4_h_shapes__Shape47__Get, true);
+	lab::BindCMethod<shapes::Shape47>(L, "Set", &Thunk_Classes4_h_shapes__Shape47__Set, false);
+	lab::BindCMethod<shapes::Shape48>(L, "Get", &Thunk_Classes4_h_shapes__Shape48__Get, true);
+	lab::BindCMethod<shapes::Shape48>(L, "Set", &Thunk_Classes4_h_shapes__Shape48__Set, false);
+	lab::BindCMethod<shapes::Shape49>(L, "Get", &Thunk_Classes4_h_shapes__Shape49__Get, true);
+	lab::BindCMethod<shapes::Shape49>(L, "Set", &Thunk_Classes4_h_shapes__Shape49__Set, false);
+	lab::BindCMethod<shapes::Shape50>(L, "Get", &Thunk_Classes4_h_shapes__Shape50__Get, true);
+	lab::BindCMethod<shapes::Shape50>(L, "Set", &Thunk_Classes4_h_shapes__Shape50__Set, false);
+	lab::BindCMethod<shapes::Shape51>(L, "Get", &Thunk_Classes4_h_shapes__Shape51__Get, true);
+	lab::BindCMethod<shapes::Shape51>(L, "Set", &Thunk_Classes4_h_shapes__Shape51__Set, false);
+	lab::BindCMethod<shapes::Shape52>(L, "Get", &Thunk_Classes4_h_shapes__Shape52__Get, true);
+	lab::BindCMethod<shapes::Shape52>(L, "Set", &Thunk_Classes4_h_shapes__Shape52__Set, false);
+	lab::BindCMethod<shapes::Shape53>(L, "Get", &Thunk_Classes4_h_shapes__Shape53__Get, true);
+	lab::BindCMethod<shapes::Shape53>(L, "Set", &Thunk_Classes4_h_shapes__Shape53__Set, false);
+	lab::BindCMethod<shapes::Shape54>(L, "Get", &Thunk_Classes4_h_shapes__Shape54__Get, true);
+	lab::BindCMethod<shapes::Shape54>(L, "Set", &Thunk_Classes4_h_shapes__Shape54__Set, false);
+	lab::BindCMethod<shapes::Shape55>(L, "Get", &Thunk_Classes4_h_shapes__Shape55__Get, true);
+	lab::BindCMethod<shapes::Shape55>(L, "Set", &Thunk_Classes4_h_shapes__Shape55__Set, false);
+	lab::BindCMethod<shapes::Shape56>(L, "Get", &Thunk_Classes4_h_shapes__Shape56__Get, true);
+	lab::BindCMethod<shapes::Shape56>(L, "Set", &Thunk_Classes4_h_shapes__Shape56__Set, false);
+	lab::BindCMethod<shapes::Shape57>(L, "Get", &Thunk_Classes4_h_shapes__Shape57__Get, true);
+	lab::BindCMethod<shapes::Shape57>(L, "Set", &Thunk_Classes4_h_shapes__Shape57__Set, false);
+	lab::BindCMethod<shapes::Shape58>(L, "Get", &Thunk_Classes4_h_shapes__Shape58__Get, true);
+	lab::BindCMethod<shapes::Shape58>(L, "Set", &Thunk_Classes4_h_shapes__Shape58__Set, false);
+	lab::BindCMethod<shapes::Shape59>(L, "Get", &Thunk_Classes4_h_shapes__Shape59__Get, true);
+	lab::BindCMethod<shapes::Shape59>(L, "Set", &Thunk_Classes4_h_shapes__Shape59__Set, false);
+	lab::BindCMethod<shapes::Shape60>(L, "Get", &Thunk_Classes4_h_shapes__Shape60__Get, true);
+	lab::BindCMethod<shapes::Shape60>(L, "Set", &Thunk_Classes4_h_shapes__Shape60__Set, false);
+	lab::BindCMethod<shapes::Shape61>(L, "Get", &Thunk_Classes4_h_shapes__Shape61__Get, true);
+	lab::BindCMethod<shapes::Shape61>(L, "Set", &Thunk_Classes4_h_shapes__Shape61__Set, false);
+	lab::BindCMethod<shapes::Shape62>(L, "Get", &Thunk_Classes4_h_shapes__Shape62__Get, true);
+	lab::BindCMethod<shapes::Shape62>(L, "Set", &Thunk_Classes4_h_shapes__Shape62__Set, false);
+	lab::BindCMethod<shapes::Shape63>(L, "Get", &Thunk_Classes4_h_shapes__Shape63__Get, true);
+	lab::BindCMethod<shapes::Shape63>(L, "Set", &Thunk_Classes4_h_shapes__Shape63__Set, false);
+}
+
+void UnregisterStaticLuaProperties_Classes4_h() 
+{
+}
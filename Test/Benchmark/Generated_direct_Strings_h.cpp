@@ -0,0 +1,24 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+#include <lab/Direct.h>
+#include "Strings.h"
+
+static int Thunk_Strings_h_bench__ViewLength(lua_State* L)
+{
+	lua_pushinteger(L, static_cast<lua_Integer>(bench::ViewLength(lab::direct::ToStringView(L, 1))));
+	return 1;
+}
+
+void RegisterAPIs_Strings_h(luaportal::LuaState& LOL) 
+{
+	LOL.GlobalContext()
+	.BeginNamespace("bench")
+	.EndNamespace()
+	;
+	lua_State* L = lab::portal::GetState(LOL);
+	lab::BindCFunction(L, "bench", "ViewLength", &Thunk_Strings_h_bench__ViewLength);
+}
+
+void UnregisterStaticLuaProperties_Strings_h() 
+{
+}
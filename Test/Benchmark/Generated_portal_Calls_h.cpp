@@ -0,0 +1,42 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+#include "Calls.h"
+
+void RegisterAPIs_Calls_h(luaportal::LuaState& LOL) 
+{
+	LOL.GlobalContext()
+	.BeginNamespace("bench")
+	.AddFunction("Add", &bench::Add)
+	.AddFunction("Length", &bench::Length)
+	.BeginClass<bench::Counter>("Counter")
+	.Def(luaportal::Constructor<>())
+	.AddStaticFunction("Twice", &bench::Counter::Twice)
+	.AddFunction("Arg0", &bench::Counter::Arg0)
+	.AddFunction("Arg1", &bench::Counter::Arg1)
+	.AddFunction("Arg2", &bench::Counter::Arg2)
+	.AddFunction("Arg3", &bench::Counter::Arg3)
+	.AddFunction("Arg4", &bench::Counter::Arg4)
+	.AddFunction("Arg5", &bench::Counter::Arg5)
+	.AddFunction("Arg6", &bench::Counter::Arg6)
+	.AddFunction("Arg7", &bench::Counter::Arg7)
+	.AddFunction("Arg8", &bench::Counter::Arg8)
+	.AddProperty("Value", &bench::Counter::GetValue, &bench::Counter::SetValue)
+	.AddFunction("Self", &bench::Counter::Self)
+	.AddFunction("Copy", &bench::Counter::Copy)
+	.AddStaticCFunction("Raw", &bench::Counter::Raw)
+	.AddData("Data", &bench::Counter::Data, true)
+	.EndClass()
+	.DeriveClass<bench::Middle,bench::Counter>("Middle")
+	.AddFunction("Depth", &bench::Middle::Depth)
+	.EndClass()
+	.DeriveClass<bench::Leaf,bench::Middle>("Leaf")
+	.Def(luaportal::Constructor<>())
+	.AddFunction("Height", &bench::Leaf::Height)
+	.EndClass()
+	.EndNamespace()
+	;
+}
+
+void UnregisterStaticLuaProperties_Calls_h() 
+{
+}
@@ -0,0 +1,35 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+#include "Classes0.h"
+
+void RegisterAPIs_Classes0_h(luaportal::LuaState& LOL) 
+{
+	LOL.GlobalContext()
+	.BeginNamespace("shapes")
+	.BeginClass<shapes::Shape0>("Shape0")
+	.AddFunction("Get", &shapes::Shape0::Get)
+	.AddFunction("Set", &shapes::Shape0::Set)
+	.AddData("Value", &shapes::Shape0::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape1>("Shape1")
+	.AddFunction("Get", &shapes::Shape1::Get)
+	.AddFunction("Set", &shapes::Shape1::Set)
+	.AddData("Value", &shapes::Shape1::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape2>("Shape2")
+	.AddFunction("Get", &shapes::Shape2::Get)
+	.AddFunction("Set", &shapes::Shape2::Set)
+	.AddData("Value", &shapes::Shape2::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape3>("Shape3")
+	.AddFunction("Get", &shapes::Shape3::Get)
+	.AddFunction("Set", &shapes::Shape3::Set)
+	.AddData("Value", &shapes::Shape3::Value, true)
+	.EndClass()
+	.EndNamespace()
+	;
+}
+
+void UnregisterStaticLuaProperties_Classes0_h() 
+{
+}
@@ -0,0 +1,35 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+#include "Classes1.h"
+
+void RegisterAPIs_Classes1_h(luaportal::LuaState& LOL) 
+{
+	LOL.GlobalContext()
+	.BeginNamespace("shapes")
+	.BeginClass<shapes::Shape4>("Shape4")
+	.AddFunction("Get", &shapes::Shape4::Get)
+	.AddFunction("Set", &shapes::Shape4::Set)
+	.AddData("Value", &shapes::Shape4::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape5>("Shape5")
+	.AddFunction("Get", &shapes::Shape5::Get)
+	.AddFunction("Set", &shapes::Shape5::Set)
+	.AddData("Value", &shapes::Shape5::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape6>("Shape6")
+	.AddFunction("Get", &shapes::Shape6::Get)
+	.AddFunction("Set", &shapes::Shape6::Set)
+	.AddData("Value", &shapes::Shape6::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape7>("Shape7")
+	.AddFunction("Get", &shapes::Shape7::Get)
+	.AddFunction("Set", &shapes::Shape7::Set)
+	.AddData("Value", &shapes::Shape7::Value, true)
+	.EndClass()
+	.EndNamespace()
+	;
+}
+
+void UnregisterStaticLuaProperties_Classes1_h() 
+{
+}
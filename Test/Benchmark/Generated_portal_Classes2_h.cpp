@@ -0,0 +1,55 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+#include "Classes2.h"
+
+void RegisterAPIs_Classes2_h(luaportal::LuaState& LOL) 
+{
+	LOL.GlobalContext()
+	.BeginNamespace("shapes")
+	.BeginClass<shapes::Shape8>("Shape8")
+	.AddFunction("Get", &shapes::Shape8::Get)
+	.AddFunction("Set", &shapes::Shape8::Set)
+	.AddData("Value", &shapes::Shape8::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape9>("Shape9")
+	.AddFunction("Get", &shapes::Shape9::Get)
+	.AddFunction("Set", &shapes::Shape9::Set)
+	.AddData("Value", &shapes::Shape9::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape10>("Shape10")
+	.AddFunction("Get", &shapes::Shape10::Get)
+	.AddFunction("Set", &shapes::Shape10::Set)
+	.AddData("Value", &shapes::Shape10::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape11>("Shape11")
+	.AddFunction("Get", &shapes::Shape11::Get)
+	.AddFunction("Set", &shapes::Shape11::Set)
+	.AddData("Value", &shapes::Shape11::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape12>("Shape12")
+	.AddFunction("Get", &shapes::Shape12::Get)
+	.AddFunction("Set", &shapes::Shape12::Set)
+	.AddData("Value", &shapes::Shape12::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape13>("Shape13")
+	.AddFunction("Get", &shapes::Shape13::Get)
+	.AddFunction("Set", &shapes::Shape13::Set)
+	.AddData("Value", &shapes::Shape13::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape14>("Shape14")
+	.AddFunction("Get", &shapes::Shape14::Get)
+	.AddFunction("Set", &shapes::Shape14::Set)
+	.AddData("Value", &shapes::Shape14::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape15>("Shape15")
+	.AddFunction("Get", &shapes::Shape15::Get)
+	.AddFunction("Set", &shapes::Shape15::Set)
+	.AddData("Value", &shapes::Shape15::Value, true)
+	.EndClass()
+	.EndNamespace()
+	;
+}
+
+void UnregisterStaticLuaProperties_Classes2_h() 
+{
+}
@@ -0,0 +1,95 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+#include "Classes3.h"
+
+void RegisterAPIs_Classes3_h(luaportal::LuaState& LOL) 
+{
+	LOL.GlobalContext()
+	.BeginNamespace("shapes")
+	.BeginClass<shapes::Shape16>("Shape16")
+	.AddFunction("Get", &shapes::Shape16::Get)
+	.AddFunction("Set", &shapes::Shape16::Set)
+	.AddData("Value", &shapes::Shape16::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape17>("Shape17")
+	.AddFunction("Get", &shapes::Shape17::Get)
+	.AddFunction("Set", &shapes::Shape17::Set)
+	.AddData("Value", &shapes::Shape17::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape18>("Shape18")
+	.AddFunction("Get", &shapes::Shape18::Get)
+	.AddFunction("Set", &shapes::Shape18::Set)
+	.AddData("Value", &shapes::Shape18::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape19>("Shape19")
+	.AddFunction("Get", &shapes::Shape19::Get)
+	.AddFunction("Set", &shapes::Shape19::Set)
+	.AddData("Value", &shapes::Shape19::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape20>("Shape20")
+	.AddFunction("Get", &shapes::Shape20::Get)
+	.AddFunction("Set", &shapes::Shape20::Set)
+	.AddData("Value", &shapes::Shape20::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape21>("Shape21")
+	.AddFunction("Get", &shapes::Shape21::Get)
+	.AddFunction("Set", &shapes::Shape21::Set)
+	.AddData("Value", &shapes::Shape21::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape22>("Shape22")
+	.AddFunction("Get", &shapes::Shape22::Get)
+	.AddFunction("Set", &shapes::Shape22::Set)
+	.AddData("Value", &shapes::Shape22::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape23>("Shape23")
+	.AddFunction("Get", &shapes::Shape23::Get)
+	.AddFunction("Set", &shapes::Shape23::Set)
+	.AddData("Value", &shapes::Shape23::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape24>("Shape24")
+	.AddFunction("Get", &shapes::Shape24::Get)
+	.AddFunction("Set", &shapes::Shape24::Set)
+	.AddData("Value", &shapes::Shape24::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape25>("Shape25")
+	.AddFunction("Get", &shapes::Shape25::Get)
+	.AddFunction("Set", &shapes::Shape25::Set)
+	.AddData("Value", &shapes::Shape25::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape26>("Shape26")
+	.AddFunction("Get", &shapes::Shape26::Get)
+	.AddFunction("Set", &shapes::Shape26::Set)
+	.AddData("Value", &shapes::Shape26::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape27>("Shape27")
+	.AddFunction("Get", &shapes::Shape27::Get)
+	.AddFunction("Set", &shapes::Shape27::Set)
+	.AddData("Value", &shapes::Shape27::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape28>("Shape28")
+	.AddFunction("Get", &shapes::Shape28::Get)
+	.AddFunction("Set", &shapes::Shape28::Set)
+	.AddData("Value", &shapes::Shape28::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape29>("Shape29")
+	.AddFunction("Get", &shapes::Shape29::Get)
+	.AddFunction("Set", &shapes::Shape29::Set)
+	.AddData("Value", &shapes::Shape29::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape30>("Shape30")
+	.AddFunction("Get", &shapes::Shape30::Get)
+	.AddFunction("Set", &shapes::Shape30::Set)
+	.AddData("Value", &shapes::Shape30::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape31>("Shape31")
+	.AddFunction("Get", &shapes::Shape31::Get)
+	.AddFunction("Set", &shapes::Shape31::Set)
+	.AddData("Value", &shapes::Shape31::Value, true)
+	.EndClass()
+	.EndNamespace()
+	;
+}
+
+void UnregisterStaticLuaProperties_Classes3_h() 
+{
+}
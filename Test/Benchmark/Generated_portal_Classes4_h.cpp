@@ -0,0 +1,175 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+#include "Classes4.h"
+
+void RegisterAPIs_Classes4_h(luaportal::LuaState& LOL) 
+{
+	LOL.GlobalContext()
+	.BeginNamespace("shapes")
+	.BeginClass<shapes::Shape32>("Shape32")
+	.AddFunction("Get", &shapes::Shape32::Get)
+	.AddFunction("Set", &shapes::Shape32::Set)
+	.AddData("Value", &shapes::Shape32::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape33>("Shape33")
+	.AddFunction("Get", &shapes::Shape33::Get)
+	.AddFunction("Set", &shapes::Shape33::Set)
+	.AddData("Value", &shapes::Shape33::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape34>("Shape34")
+	.AddFunction("Get", &shapes::Shape34::Get)
+	.AddFunction("Set", &shapes::Shape34::Set)
+	.AddData("Value", &shapes::Shape34::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape35>("Shape35")
+	.AddFunction("Get", &shapes::Shape35::Get)
+	.AddFunction("Set", &shapes::Shape35::Set)
+	.AddData("Value", &shapes::Shape35::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape36>("Shape36")
+	.AddFunction("Get", &shapes::Shape36::Get)
+	.AddFunction("Set", &shapes::Shape36::Set)
+	.AddData("Value", &shapes::Shape36::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape37>("Shape37")
+	.AddFunction("Get", &shapes::Shape37::Get)
+	.AddFunction("Set", &shapes::Shape37::Set)
+	.AddData("Value", &shapes::Shape37::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape38>("Shape38")
+	.AddFunction("Get", &shapes::Shape38::Get)
+	.AddFunction("Set", &shapes::Shape38::Set)
+	.AddData("Value", &shapes::Shape38::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape39>("Shape39")
+	.AddFunction("Get", &shapes::Shape39::Get)
+	.AddFunction("Set", &shapes::Shape39::Set)
+	.AddData("Value", &shapes::Shape39::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape40>("Shape40")
+	.AddFunction("Get", &shapes::Shape40::Get)
+	.AddFunction("Set", &shapes::Shape40::Set)
+	.AddData("Value", &shapes::Shape40::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape41>("Shape41")
+	.AddFunction("Get", &shapes::Shape41::Get)
+	.AddFunction("Set", &shapes::Shape41::Set)
+	.AddData("Value", &shapes::Shape41::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape42>("Shape42")
+	.AddFunction("Get", &shapes::Shape42::Get)
+	.AddFunction("Set", &shapes::Shape42::Set)
+	.AddData("Value", &shapes::Shape42::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape43>("Shape43")
+	.AddFunction("Get", &shapes::Shape43::Get)
+	.AddFunction("Set", &shapes::Shape43::Set)
+	.AddData("Value", &shapes::Shape43::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape44>("Shape44")
+	.AddFunction("Get", &shapes::Shape44::Get)
+	.AddFunction("Set", &shapes::Shape44::Set)
+	.AddData("Value", &shapes::Shape44::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape45>("Shape45")
+	.AddFunction("Get", &shapes::Shape45::Get)
+	.AddFunction("Set", &shapes::Shape45::Set)
+	.AddData("Value", &shapes::Shape45::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape46>("Shape46")
+	.AddFunction("Get", &shapes::Shape46::Get)
+	.AddFunction("Set", &shapes::Shape46::Set)
+	.AddData("Value", &shapes::Shape46::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape47>("Shape47")
+	.AddFunction("Get", &shapes::Shape47::Get)
+	.AddFunction("Set", &shapes::Shape47::Set)
+	.AddData("Value", &shapes::Shape47::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape48>("Shape48")
+	.AddFunction("Get", &shapes::Shape48::Get)
+	.AddFunction("Set", &shapes::Shape48::Set)
+	.AddData("Value", &shapes::Shape48::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape49>("Shape49")
+	.AddFunction("Get", &shapes::Shape49::Get)
+	.AddFunction("Set", &shapes::Shape49::Set)
+	.AddData("Value", &shapes::Shape49::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape50>("Shape50")
+	.AddFunction("Get", &shapes::Shape50::Get)
+	.AddFunction("Set", &shapes::Shape50::Set)
+	.AddData("Value", &shapes::Shape50::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape51>("Shape51")
+	.AddFunction("Get", &shapes::Shape51::Get)
+	.AddFunction("Set", &shapes::Shape51::Set)
+	.AddData("Value", &shapes::Shape51::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape52>("Shape52")
+	.AddFunction("Get", &shapes::Shape52::Get)
+	.AddFunction("Set", &shapes::Shape52::Set)
+	.AddData("Value", &shapes::Shape52::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape53>("Shape53")
+	.AddFunction("Get", &shapes::Shape53::Get)
+	.AddFunction("Set", &shapes::Shape53::Set)
+	.AddData("Value", &shapes::Shape53::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape54>("Shape54")
+	.AddFunction("Get", &shapes::Shape54::Get)
+	.AddFunction("Set", &shapes::Shape54::Set)
+	.AddData("Value", &shapes::Shape54::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape55>("Shape55")
+	.AddFunction("Get", &shapes::Shape55::Get)
+	.AddFunction("Set", &shapes::Shape55::Set)
+	.AddData("Value", &shapes::Shape55::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape56>("Shape56")
+	.AddFunction("Get", &shapes::Shape56::Get)
+	.AddFunction("Set", &shapes::Shape56::Set)
+	.AddData("Value", &shapes::Shape56::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape57>("Shape57")
+	.AddFunction("Get", &shapes::Shape57::Get)
+	.AddFunction("Set", &shapes::Shape57::Set)
+	.AddData("Value", &shapes::Shape57::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape58>("Shape58")
+	.AddFunction("Get", &shapes::Shape58::Get)
+	.AddFunction("Set", &shapes::Shape58::Set)
+	.AddData("Value", &shapes::Shape58::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape59>("Shape59")
+	.AddFunction("Get", &shapes::Shape59::Get)
+	.AddFunction("Set", &shapes::Shape59::Set)
+	.AddData("Value", &shapes::Shape59::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape60>("Shape60")
+	.AddFunction("Get", &shapes::Shape60::Get)
+	.AddFunction("Set", &shapes::Shape60::Set)
+	.AddData("Value", &shapes::Shape60::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape61>("Shape61")
+	.AddFunction("Get", &shapes::Shape61::Get)
+	.AddFunction("Set", &shapes::Shape61::Set)
+	.AddData("Value", &shapes::Shape61::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape62>("Shape62")
+	.AddFunction("Get", &shapes::Shape62::Get)
+	.AddFunction("Set", &shapes::Shape62::Set)
+	.AddData("Value", &shapes::Shape62::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape63>("Shape63")
+	.AddFunction("Get", &shapes::Shape63::Get)
+	.AddFunction("Set", &shapes::Shape63::Set)
+	.AddData("Value", &shapes::Shape63::Value, true)
+	.EndClass()
+	.EndNamespace()
+	;
+}
+
+void UnregisterStaticLuaProperties_Classes4_h() 
+{
+}
@@ -0,0 +1,160 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+#include <lab/Direct.h>
+#include <lab/Profile.h>
+#include "Classes1.h"
+
+static lab::BindingStats Profile_Classes1_h[8];
+static const char* const ProfileNames_Classes1_h[] = {
+	"shapes.Shape4.Get",
+	"shapes.Shape4.Set",
+	"shapes.Shape5.Get",
+	"shapes.Shape5.Set",
+	"shapes.Shape6.Get",
+	"shapes.Shape6.Set",
+	"shapes.Shape7.Get",
+	"shapes.Shape7.Set",
+};
+static lab::ProfileBlock ProfileBlock_Classes1_h(ProfileNames_Classes1_h, Profile_Classes1_h, 8);
+
+static int Thunk_Classes1_h_shapes__Shape4__Get(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes1_h[0]);
+	auto Self = lab::portal::GetObject<shapes::Shape4>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes1_h_shapes__Shape4__Set(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes1_h[1]);
+	auto Self = lab::portal::GetObject<shapes::Shape4>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes1_h_shapes__Shape5__Get(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes1_h[2]);
+	auto Self = lab::portal::GetObject<shapes::Shape5>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes1_h_shapes__Shape5__Set(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes1_h[3]);
+	auto Self = lab::portal::GetObject<shapes::Shape5>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes1_h_shapes__Shape6__Get(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes1_h[4]);
+	auto Self = lab::portal::GetObject<shapes::Shape6>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes1_h_shapes__Shape6__Set(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes1_h[5]);
+	auto Self = lab::portal::GetObject<shapes::Shape6>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes1_h_shapes__Shape7__Get(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes1_h[6]);
+	auto Self = lab::portal::GetObject<shapes::Shape7>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes1_h_shapes__Shape7__Set(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes1_h[7]);
+	auto Self = lab::portal::GetObject<shapes::Shape7>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+void RegisterAPIs_Classes1_h(luaportal::LuaState& LOL) 
+{
+	LOL.GlobalContext()
+	.BeginNamespace("shapes")
+	.BeginClass<shapes::Shape4>("Shape4")
+	.AddData("Value", &shapes::Shape4::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape5>("Shape5")
+	.AddData("Value", &shapes::Shape5::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape6>("Shape6")
+	.AddData("Value", &shapes::Shape6::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape7>("Shape7")
+	.AddData("Value", &shapes::Shape7::Value, true)
+	.EndClass()
+	.EndNamespace()
+	;
+	lua_State* L = lab::portal::GetState(LOL);
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes1_h_shapes__Shape4__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape4>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes1_h_shapes__Shape4__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape4>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape4>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes1_h_shapes__Shape5__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape5>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes1_h_shapes__Shape5__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape5>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape5>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes1_h_shapes__Shape6__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape6>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes1_h_shapes__Shape6__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape6>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape6>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes1_h_shapes__Shape7__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape7>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes1_h_shapes__Shape7__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape7>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape7>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	lab::BindProfile(L);
+}
+
+void UnregisterStaticLuaProperties_Classes1_h() 
+{
+}
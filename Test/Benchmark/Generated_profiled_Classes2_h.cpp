@@ -0,0 +1,296 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+#include <lab/Direct.h>
+#include <lab/Profile.h>
+#include "Classes2.h"
+
+static lab::BindingStats Profile_Classes2_h[16];
+static const char* const ProfileNames_Classes2_h[] = {
+	"shapes.Shape8.Get",
+	"shapes.Shape8.Set",
+	"shapes.Shape9.Get",
+	"shapes.Shape9.Set",
+	"shapes.Shape10.Get",
+	"shapes.Shape10.Set",
+	"shapes.Shape11.Get",
+	"shapes.Shape11.Set",
+	"shapes.Shape12.Get",
+	"shapes.Shape12.Set",
+	"shapes.Shape13.Get",
+	"shapes.Shape13.Set",
+	"shapes.Shape14.Get",
+	"shapes.Shape14.Set",
+	"shapes.Shape15.Get",
+	"shapes.Shape15.Set",
+};
+static lab::ProfileBlock ProfileBlock_Classes2_h(ProfileNames_Classes2_h, Profile_Classes2_h, 16);
+
+static int Thunk_Classes2_h_shapes__Shape8__Get(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes2_h[0]);
+	auto Self = lab::portal::GetObject<shapes::Shape8>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape8__Set(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes2_h[1]);
+	auto Self = lab::portal::GetObject<shapes::Shape8>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes2_h_shapes__Shape9__Get(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes2_h[2]);
+	auto Self = lab::portal::GetObject<shapes::Shape9>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape9__Set(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes2_h[3]);
+	auto Self = lab::portal::GetObject<shapes::Shape9>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes2_h_shapes__Shape10__Get(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes2_h[4]);
+	auto Self = lab::portal::GetObject<shapes::Shape10>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape10__Set(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes2_h[5]);
+	auto Self = lab::portal::GetObject<shapes::Shape10>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes2_h_shapes__Shape11__Get(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes2_h[6]);
+	auto Self = lab::portal::GetObject<shapes::Shape11>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape11__Set(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes2_h[7]);
+	auto Self = lab::portal::GetObject<shapes::Shape11>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes2_h_shapes__Shape12__Get(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes2_h[8]);
+	auto Self = lab::portal::GetObject<shapes::Shape12>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape12__Set(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes2_h[9]);
+	auto Self = lab::portal::GetObject<shapes::Shape12>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes2_h_shapes__Shape13__Get(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes2_h[10]);
+	auto Self = lab::portal::GetObject<shapes::Shape13>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape13__Set(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes2_h[11]);
+	auto Self = lab::portal::GetObject<shapes::Shape13>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes2_h_shapes__Shape14__Get(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes2_h[12]);
+	auto Self = lab::portal::GetObject<shapes::Shape14>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape14__Set(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes2_h[13]);
+	auto Self = lab::portal::GetObject<shapes::Shape14>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes2_h_shapes__Shape15__Get(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes2_h[14]);
+	auto Self = lab::portal::GetObject<shapes::Shape15>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape15__Set(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes2_h[15]);
+	auto Self = lab::portal::GetObject<shapes::Shape15>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+void RegisterAPIs_Classes2_h(luaportal::LuaState& LOL) 
+{
+	LOL.GlobalContext()
+	.BeginNamespace("shapes")
+	.BeginClass<shapes::Shape8>("Shape8")
+	.AddData("Value", &shapes::Shape8::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape9>("Shape9")
+	.AddData("Value", &shapes::Shape9::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape10>("Shape10")
+	.AddData("Value", &shapes::Shape10::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape11>("Shape11")
+	.AddData("Value", &shapes::Shape11::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape12>("Shape12")
+	.AddData("Value", &shapes::Shape12::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape13>("Shape13")
+	.AddData("Value", &shapes::Shape13::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape14>("Shape14")
+	.AddData("Value", &shapes::Shape14::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape15>("Shape15")
+	.AddData("Value", &shapes::Shape15::Value, true)
+	.EndClass()
+	.EndNamespace()
+	;
+	lua_State* L = lab::portal::GetState(LOL);
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes2_h_shapes__Shape8__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape8>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes2_h_shapes__Shape8__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape8>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape8>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes2_h_shapes__Shape9__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape9>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes2_h_shapes__Shape9__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape9>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape9>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes2_h_shapes__Shape10__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape10>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes2_h_shapes__Shape10__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape10>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape10>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes2_h_shapes__Shape11__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape11>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes2_h_shapes__Shape11__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape11>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape11>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes2_h_shapes__Shape12__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape12>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes2_h_shapes__Shape12__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape12>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape12>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes2_h_shapes__Shape13__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape13>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes2_h_shapes__Shape13__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape13>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape13>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes2_h_shapes__Shape14__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape14>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes2_h_shapes__Shape14__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape14>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape14>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes2_h_shapes__Shape15__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape15>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes2_h_shapes__Shape15__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape15>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape15>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	lab::BindProfile(L);
+}
+
+void UnregisterStaticLuaProperties_Classes2_h() 
+{
+}
@@ -0,0 +1,568 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+#include <lab/Direct.h>
+#include <lab/Profile.h>
+#include "Classes3.h"
+
+static lab::BindingStats Profile_Classes3_h[32];
+static const char* const ProfileNames_Classes3_h[] = {
+	"shapes.Shape16.Get",
+	"shapes.Shape16.Set",
+	"shapes.Shape17.Get",
+	"shapes.Shape17.Set",
+	"shapes.Shape18.Get",
+	"shapes.Shape18.Set",
+	"shapes.Shape19.Get",
+	"shapes.Shape19.Set",
+	"shapes.Shape20.Get",
+	"shapes.Shape20.Set",
+	"shapes.Shape21.Get",
+	"shapes.Shape21.Set",
+	"shapes.Shape22.Get",
+	"shapes.Shape22.Set",
+	"shapes.Shape23.Get",
+	"shapes.Shape23.Set",
+	"shapes.Shape24.Get",
+	"shapes.Shape24.Set",
+	"shapes.Shape25.Get",
+	"shapes.Shape25.Set",
+	"shapes.Shape26.Get",
+	"shapes.Shape26.Set",
+	"shapes.Shape27.Get",
+	"shapes.Shape27.Set",
+	"shapes.Shape28.Get",
+	"shapes.Shape28.Set",
+	"shapes.Shape29.Get",
+	"shapes.Shape29.Set",
+	"shapes.Shape30.Get",
+	"shapes.Shape30.Set",
+	"shapes.Shape31.Get",
+	"shapes.Shape31.Set",
+};
+static lab::ProfileBlock ProfileBlock_Classes3_h(ProfileNames_Classes3_h, Profile_Classes3_h, 32);
+
+static int Thunk_Classes3_h_shapes__Shape16__Get(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[0]);
+	auto Self = lab::portal::GetObject<shapes::Shape16>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape16__Set(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[1]);
+	auto Self = lab::portal::GetObject<shapes::Shape16>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape17__Get(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[2]);
+	auto Self = lab::portal::GetObject<shapes::Shape17>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape17__Set(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[3]);
+	auto Self = lab::portal::GetObject<shapes::Shape17>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape18__Get(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[4]);
+	auto Self = lab::portal::GetObject<shapes::Shape18>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape18__Set(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[5]);
+	auto Self = lab::portal::GetObject<shapes::Shape18>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape19__Get(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[6]);
+	auto Self = lab::portal::GetObject<shapes::Shape19>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape19__Set(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[7]);
+	auto Self = lab::portal::GetObject<shapes::Shape19>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape20__Get(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[8]);
+	auto Self = lab::portal::GetObject<shapes::Shape20>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape20__Set(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[9]);
+	auto Self = lab::portal::GetObject<shapes::Shape20>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape21__Get(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[10]);
+	auto Self = lab::portal::GetObject<shapes::Shape21>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape21__Set(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[11]);
+	auto Self = lab::portal::GetObject<shapes::Shape21>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape22__Get(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[12]);
+	auto Self = lab::portal::GetObject<shapes::Shape22>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape22__Set(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[13]);
+	auto Self = lab::portal::GetObject<shapes::Shape22>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape23__Get(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[14]);
+	auto Self = lab::portal::GetObject<shapes::Shape23>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape23__Set(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[15]);
+	auto Self = lab::portal::GetObject<shapes::Shape23>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape24__Get(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[16]);
+	auto Self = lab::portal::GetObject<shapes::Shape24>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape24__Set(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[17]);
+	auto Self = lab::portal::GetObject<shapes::Shape24>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape25__Get(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[18]);
+	auto Self = lab::portal::GetObject<shapes::Shape25>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape25__Set(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[19]);
+	auto Self = lab::portal::GetObject<shapes::Shape25>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape26__Get(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[20]);
+	auto Self = lab::portal::GetObject<shapes::Shape26>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape26__Set(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[21]);
+	auto Self = lab::portal::GetObject<shapes::Shape26>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape27__Get(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[22]);
+	auto Self = lab::portal::GetObject<shapes::Shape27>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape27__Set(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[23]);
+	auto Self = lab::portal::GetObject<shapes::Shape27>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape28__Get(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[24]);
+	auto Self = lab::portal::GetObject<shapes::Shape28>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape28__Set(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[25]);
+	auto Self = lab::portal::GetObject<shapes::Shape28>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape29__Get(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[26]);
+	auto Self = lab::portal::GetObject<shapes::Shape29>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape29__Set(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[27]);
+	auto Self = lab::portal::GetObject<shapes::Shape29>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape30__Get(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[28]);
+	auto Self = lab::portal::GetObject<shapes::Shape30>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape30__Set(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[29]);
+	auto Self = lab::portal::GetObject<shapes::Shape30>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape31__Get(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[30]);
+	auto Self = lab::portal::GetObject<shapes::Shape31>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape31__Set(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Classes3_h[31]);
+	auto Self = lab::portal::GetObject<shapes::Shape31>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+void RegisterAPIs_Classes3_h(luaportal::LuaState& LOL) 
+{
+	LOL.GlobalContext()
+	.BeginNamespace("shapes")
+	.BeginClass<shapes::Shape16>("Shape16")
+	.AddData("Value", &shapes::Shape16::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape17>("Shape17")
+	.AddData("Value", &shapes::Shape17::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape18>("Shape18")
+	.AddData("Value", &shapes::Shape18::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape19>("Shape19")
+	.AddData("Value", &shapes::Shape19::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape20>("Shape20")
+	.AddData("Value", &shapes::Shape20::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape21>("Shape21")
+	.AddData("Value", &shapes::Shape21::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape22>("Shape22")
+	.AddData("Value", &shapes::Shape22::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape23>("Shape23")
+	.AddData("Value", &shapes::Shape23::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape24>("Shape24")
+	.AddData("Value", &shapes::Shape24::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape25>("Shape25")
+	.AddData("Value", &shapes::Shape25::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape26>("Shape26")
+	.AddData("Value", &shapes::Shape26::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape27>("Shape27")
+	.AddData("Value", &shapes::Shape27::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape28>("Shape28")
+	.AddData("Value", &shapes::Shape28::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape29>("Shape29")
+	.AddData("Value", &shapes::Shape29::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape30>("Shape30")
+	.AddData("Value", &shapes::Shape30::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape31>("Shape31")
+	.AddData("Value", &shapes::Shape31::Value, true)
+	.EndClass()
+	.EndNamespace()
+	;
+	lua_State* L = lab::portal::GetState(LOL);
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape16__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape16>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape16__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape16>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape16>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape17__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape17>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape17__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape17>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape17>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape18__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape18>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape18__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape18>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape18>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape19__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape19>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape19__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape19>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape19>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape20__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape20>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape20__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape20>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape20>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape21__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape21>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape21__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape21>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape21>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape22__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape22>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape22__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape22>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape22>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape23__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape23>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape23__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape23>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape23>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape24__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape24>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape24__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape24>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape24>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape25__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape25>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape25__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape25>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape25>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape26__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape26>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape26__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape26>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape26>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape27__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape27>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape27__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape27>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape27>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape28__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape28>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape28__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape28>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape28>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape29__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape29>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape29__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape29>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape29>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape30__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape30>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape30__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape30>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape30>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape31__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape31>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape31__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape31>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape31>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	lab::BindProfile(L);
+}
+
+void UnregisterStaticLuaProperties_Classes3_h() 
+{
+}
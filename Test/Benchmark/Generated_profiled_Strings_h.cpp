@@ -0,0 +1,33 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+#include <lab/Direct.h>
+#include <lab/Profile.h>
+#include "Strings.h"
+
+static lab::BindingStats Profile_Strings_h[1];
+static const char* const ProfileNames_Strings_h[] = {
+	"bench.ViewLength",
+};
+static lab::ProfileBlock ProfileBlock_Strings_h(ProfileNames_Strings_h, Profile_Strings_h, 1);
+
+static int Thunk_Strings_h_bench__ViewLength(lua_State* L)
+{
+	LAB_PROFILE_CALL(Profile_Strings_h[0]);
+	lua_pushinteger(L, static_cast<lua_Integer>(bench::ViewLength(lab::direct::ToStringView(L, 1))));
+	return 1;
+}
+
+void RegisterAPIs_Strings_h(luaportal::LuaState& LOL) 
+{
+	LOL.GlobalContext()
+	.BeginNamespace("bench")
+	.EndNamespace()
+	;
+	lua_State* L = lab::portal::GetState(LOL);
+	lab::BindCFunction(L, "bench", "ViewLength", &Thunk_Strings_h_bench__ViewLength);
+	lab::BindProfile(L);
+}
+
+void UnregisterStaticLuaProperties_Strings_h() 
+{
+}
@@ -0,0 +1,35 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+
+void RegisterAPIs_Calls_h(luaportal::LuaState& LOL);
+void UnregisterStaticLuaProperties_Calls_h();
+void RegisterAPIs_Classes0_h(luaportal::LuaState& LOL);
+void UnregisterStaticLuaProperties_Classes0_h();
+void RegisterAPIs_Classes1_h(luaportal::LuaState& LOL);
+void UnregisterStaticLuaProperties_Classes1_h();
+void RegisterAPIs_Classes2_h(luaportal::LuaState& LOL);
+void UnregisterStaticLuaProperties_Classes2_h();
+void RegisterAPIs_Classes3_h(luaportal::LuaState& LOL);
+void UnregisterStaticLuaProperties_Classes3_h();
+void RegisterAPIs_Classes4_h(luaportal::LuaState& LOL);
+void UnregisterStaticLuaProperties_Classes4_h();
+
+void RegisterAPIs(luaportal::LuaState& LOL) 
+{
+	RegisterAPIs_Calls_h(LOL);
+	RegisterAPIs_Classes0_h(LOL);
+	RegisterAPIs_Classes1_h(LOL);
+	RegisterAPIs_Classes2_h(LOL);
+	RegisterAPIs_Classes3_h(LOL);
+	RegisterAPIs_Classes4_h(LOL);
+}
+
+void UnregisterStaticLuaProperties() 
+{
+	UnregisterStaticLuaProperties_Calls_h();
+	UnregisterStaticLuaProperties_Classes0_h();
+	UnregisterStaticLuaProperties_Classes1_h();
+	UnregisterStaticLuaProperties_Classes2_h();
+	UnregisterStaticLuaProperties_Classes3_h();
+	UnregisterStaticLuaProperties_Classes4_h();
+}
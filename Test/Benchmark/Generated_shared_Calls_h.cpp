@@ -0,0 +1,44 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+#include <lab/Thunk.h>
+#include "Calls.h"
+
+void RegisterAPIs_Calls_h(luaportal::LuaState& LOL) 
+{
+	LOL.GlobalContext()
+	.BeginNamespace("bench")
+	.BeginClass<bench::Counter>("Counter")
+	.Def(luaportal::Constructor<>())
+	.AddProperty("Value", &bench::Counter::GetValue, &bench::Counter::SetValue)
+	.AddStaticCFunction("Raw", &bench::Counter::Raw)
+	.AddData("Data", &bench::Counter::Data, true)
+	.EndClass()
+	.DeriveClass<bench::Middle,bench::Counter>("Middle")
+	.EndClass()
+	.DeriveClass<bench::Leaf,bench::Middle>("Leaf")
+	.Def(luaportal::Constructor<>())
+	.EndClass()
+	.EndNamespace()
+	;
+	lua_State* L = lab::portal::GetState(LOL);
+	lab::BindFunction(L, "bench", "Add", &bench::Add);
+	lab::BindFunction(L, "bench", "Length", &bench::Length);
+	lab::BindStatic<bench::Counter>(L, "Twice", &bench::Counter::Twice);
+	lab::BindMethod<bench::Counter>(L, "Arg0", &bench::Counter::Arg0);
+	lab::BindMethod<bench::Counter>(L, "Arg1", &bench::Counter::Arg1);
+	lab::BindMethod<bench::Counter>(L, "Arg2", &bench::Counter::Arg2);
+	lab::BindMethod<bench::Counter>(L, "Arg3", &bench::Counter::Arg3);
+	lab::BindMethod<bench::Counter>(L, "Arg4", &bench::Counter::Arg4);
+	lab::BindMethod<bench::Counter>(L, "Arg5", &bench::Counter::Arg5);
+	lab::BindMethod<bench::Counter>(L, "Arg6", &bench::Counter::Arg6);
+	lab::BindMethod<bench::Counter>(L, "Arg7", &bench::Counter::Arg7);
+	lab::BindMethod<bench::Counter>(L, "Arg8", &bench::Counter::Arg8);
+	lab::BindMethod<bench::Counter>(L, "Self", &bench::Counter::Self);
+	lab::BindMethod<bench::Counter>(L, "Copy", &bench::Counter::Copy);
+	lab::BindMethod<bench::Middle>(L, "Depth", &bench::Middle::Depth);
+	lab::BindMethod<bench::Leaf>(L, "Height", &bench::Leaf::Height);
+}
+
+void UnregisterStaticLuaProperties_Calls_h() 
+{
+}
@@ -0,0 +1,37 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+#include <lab/Thunk.h>
+#include "Classes0.h"
+
+void RegisterAPIs_Classes0_h(luaportal::LuaState& LOL) 
+{
+	LOL.GlobalContext()
+	.BeginNamespace("shapes")
+	.BeginClass<shapes::Shape0>("Shape0")
+	.AddData("Value", &shapes::Shape0::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape1>("Shape1")
+	.AddData("Value", &shapes::Shape1::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape2>("Shape2")
+	.AddData("Value", &shapes::Shape2::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape3>("Shape3")
+	.AddData("Value", &shapes::Shape3::Value, true)
+	.EndClass()
+	.EndNamespace()
+	;
+	lua_State* L = lab::portal::GetState(LOL);
+	lab::BindMethod<shapes::Shape0>(L, "Get", &shapes::Shape0::Get);
+	lab::BindMethod<shapes::Shape0>(L, "Set", &shapes::Shape0::Set);
+	lab::BindMethod<shapes::Shape1>(L, "Get", &shapes::Shape1::Get);
+	lab::BindMethod<shapes::Shape1>(L, "Set", &shapes::Shape1::Set);
+	lab::BindMethod<shapes::Shape2>(L, "Get", &shapes::Shape2::Get);
+	lab::BindMethod<shapes::Shape2>(L, "Set", &shapes::Shape2::Set);
+	lab::BindMethod<shapes::Shape3>(L, "Get", &shapes::Shape3::Get);
+	lab::BindMethod<shapes::Shape3>(L, "Set", &shapes::Shape3::Set);
+}
+
+void UnregisterStaticLuaProperties_Classes0_h() 
+{
+}
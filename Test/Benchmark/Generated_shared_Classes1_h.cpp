@@ -0,0 +1,37 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+#include <lab/Thunk.h>
+#include "Classes1.h"
+
+void RegisterAPIs_Classes1_h(luaportal::LuaState& LOL) 
+{
+	LOL.GlobalContext()
+	.BeginNamespace("shapes")
+	.BeginClass<shapes::Shape4>("Shape4")
+	.AddData("Value", &shapes::Shape4::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape5>("Shape5")
+	.AddData("Value", &shapes::Shape5::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape6>("Shape6")
+	.AddData("Value", &shapes::Shape6::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape7>("Shape7")
+	.AddData("Value", &shapes::Shape7::Value, true)
+	.EndClass()
+	.EndNamespace()
+	;
+	lua_State* L = lab::portal::GetState(LOL);
+	lab::BindMethod<shapes::Shape4>(L, "Get", &shapes::Shape4::Get);
+	lab::BindMethod<shapes::Shape4>(L, "Set", &shapes::Shape4::Set);
+	lab::BindMethod<shapes::Shape5>(L, "Get", &shapes::Shape5::Get);
+	lab::BindMethod<shapes::Shape5>(L, "Set", &shapes::Shape5::Set);
+	lab::BindMethod<shapes::Shape6>(L, "Get", &shapes::Shape6::Get);
+	lab::BindMethod<shapes::Shape6>(L, "Set", &shapes::Shape6::Set);
+	lab::BindMethod<shapes::Shape7>(L, "Get", &shapes::Shape7::Get);
+	lab::BindMethod<shapes::Shape7>(L, "Set", &shapes::Shape7::Set);
+}
+
+void UnregisterStaticLuaProperties_Classes1_h() 
+{
+}
@@ -0,0 +1,57 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+#include <lab/Thunk.h>
+#include "Classes2.h"
+
+void RegisterAPIs_Classes2_h(luaportal::LuaState& LOL) 
+{
+	LOL.GlobalContext()
+	.BeginNamespace("shapes")
+	.BeginClass<shapes::Shape8>("Shape8")
+	.AddData("Value", &shapes::Shape8::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape9>("Shape9")
+	.AddData("Value", &shapes::Shape9::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape10>("Shape10")
+	.AddData("Value", &shapes::Shape10::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape11>("Shape11")
+	.AddData("Value", &shapes::Shape11::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape12>("Shape12")
+	.AddData("Value", &shapes::Shape12::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape13>("Shape13")
+	.AddData("Value", &shapes::Shape13::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape14>("Shape14")
+	.AddData("Value", &shapes::Shape14::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape15>("Shape15")
+	.AddData("Value", &shapes::Shape15::Value, true)
+	.EndClass()
+	.EndNamespace()
+	;
+	lua_State* L = lab::portal::GetState(LOL);
+	lab::BindMethod<shapes::Shape8>(L, "Get", &shapes::Shape8::Get);
+	lab::BindMethod<shapes::Shape8>(L, "Set", &shapes::Shape8::Set);
+	lab::BindMethod<shapes::Shape9>(L, "Get", &shapes::Shape9::Get);
+	lab::BindMethod<shapes::Shape9>(L, "Set", &shapes::Shape9::Set);
+	lab::BindMethod<shapes::Shape10>(L, "Get", &shapes::Shape10::Get);
+	lab::BindMethod<shapes::Shape10>(L, "Set", &shapes::Shape10::Set);
+	lab::BindMethod<shapes::Shape11>(L, "Get", &shapes::Shape11::Get);
+	lab::BindMethod<shapes::Shape11>(L, "Set", &shapes::Shape11::Set);
+	lab::BindMethod<shapes::Shape12>(L, "Get", &shapes::Shape12::Get);
+	lab::BindMethod<shapes::Shape12>(L, "Set", &shapes::Shape12::Set);
+	lab::BindMethod<shapes::Shape13>(L, "Get", &shapes::Shape13::Get);
+	lab::BindMethod<shapes::Shape13>(L, "Set", &shapes::Shape13::Set);
+	lab::BindMethod<shapes::Shape14>(L, "Get", &shapes::Shape14::Get);
+	lab::BindMethod<shapes::Shape14>(L, "Set", &shapes::Shape14::Set);
+	lab::BindMethod<shapes::Shape15>(L, "Get", &shapes::Shape15::Get);
+	lab::BindMethod<shapes::Shape15>(L, "Set", &shapes::Shape15::Set);
+}
+
+void UnregisterStaticLuaProperties_Classes2_h() 
+{
+}
@@ -0,0 +1,97 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+#include <lab/Thunk.h>
+#include "Classes3.h"
+
+void RegisterAPIs_Classes3_h(luaportal::LuaState& LOL) 
+{
+	LOL.GlobalContext()
+	.BeginNamespace("shapes")
+	.BeginClass<shapes::Shape16>("Shape16")
+	.AddData("Value", &shapes::Shape16::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape17>("Shape17")
+	.AddData("Value", &shapes::Shape17::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape18>("Shape18")
+	.AddData("Value", &shapes::Shape18::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape19>("Shape19")
+	.AddData("Value", &shapes::Shape19::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape20>("Shape20")
+	.AddData("Value", &shapes::Shape20::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape21>("Shape21")
+	.AddData("Value", &shapes::Shape21::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape22>("Shape22")
+	.AddData("Value", &shapes::Shape22::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape23>("Shape23")
+	.AddData("Value", &shapes::Shape23::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape24>("Shape24")
+	.AddData("Value", &shapes::Shape24::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape25>("Shape25")
+	.AddData("Value", &shapes::Shape25::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape26>("Shape26")
+	.AddData("Value", &shapes::Shape26::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape27>("Shape27")
+	.AddData("Value", &shapes::Shape27::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape28>("Shape28")
+	.AddData("Value", &shapes::Shape28::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape29>("Shape29")
+	.AddData("Value", &shapes::Shape29::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape30>("Shape30")
+	.AddData("Value", &shapes::Shape30::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape31>("Shape31")
+	.AddData("Value", &shapes::Shape31::Value, true)
+	.EndClass()
+	.EndNamespace()
+	;
+	lua_State* L = lab::portal::GetState(LOL);
+	lab::BindMethod<shapes::Shape16>(L, "Get", &shapes::Shape16::Get);
+	lab::BindMethod<shapes::Shape16>(L, "Set", &shapes::Shape16::Set);
+	lab::BindMethod<shapes::Shape17>(L, "Get", &shapes::Shape17::Get);
+	lab::BindMethod<shapes::Shape17>(L, "Set", &shapes::Shape17::Set);
+	lab::BindMethod<shapes::Shape18>(L, "Get", &shapes::Shape18::Get);
+	lab::BindMethod<shapes::Shape18>(L, "Set", &shapes::Shape18::Set);
+	lab::BindMethod<shapes::Shape19>(L, "Get", &shapes::Shape19::Get);
+	lab::BindMethod<shapes::Shape19>(L, "Set", &shapes::Shape19::Set);
+	lab::BindMethod<shapes::Shape20>(L, "Get", &shapes::Shape20::Get);
+	lab::BindMethod<shapes::Shape20>(L, "Set", &shapes::Shape20::Set);
+	lab::BindMethod<shapes::Shape21>(L, "Get", &shapes::Shape21::Get);
+	lab::BindMethod<shapes::Shape21>(L, "Set", &shapes::Shape21::Set);
+	lab::BindMethod<shapes::Shape22>(L, "Get", &shapes::Shape22::Get);
+	lab::BindMethod<shapes::Shape22>(L, "Set", &shapes::Shape22::Set);
+	lab::BindMethod<shapes::Shape23>(L, "Get", &shapes::Shape23::Get);
+	lab::BindMethod<shapes::Shape23>(L, "Set", &shapes::Shape23::Set);
+	lab::BindMethod<shapes::Shape24>(L, "Get", &shapes::Shape24::Get);
+	lab::BindMethod<shapes::Shape24>(L, "Set", &shapes::Shape24::Set);
+	lab::BindMethod<shapes::Shape25>(L, "Get", &shapes::Shape25::Get);
+	lab::BindMethod<shapes::Shape25>(L, "Set", &shapes::Shape25::Set);
+	lab::BindMethod<shapes::Shape26>(L, "Get", &shapes::Shape26::Get);
+	lab::BindMethod<shapes::Shape26>(L, "Set", &shapes::Shape26::Set);
+	lab::BindMethod<shapes::Shape27>(L, "Get", &shapes::Shape27::Get);
+	lab::BindMethod<shapes::Shape27>(L, "Set", &shapes::Shape27::Set);
+	lab::BindMethod<shapes::Shape28>(L, "Get", &shapes::Shape28::Get);
+	lab::BindMethod<shapes::Shape28>(L, "Set", &shapes::Shape28::Set);
+	lab::BindMethod<shapes::Shape29>(L, "Get", &shapes::Shape29::Get);
+	lab::BindMethod<shapes::Shape29>(L, "Set", &shapes::Shape29::Set);
+	lab::BindMethod<shapes::Shape30>(L, "Get", &shapes::Shape30::Get);
+	lab::BindMethod<shapes::Shape30>(L, "Set", &shapes::Shape30::Set);
+	lab::BindMethod<shapes::Shape31>(L, "Get", &shapes::Shape31::Get);
+	lab::BindMethod<shapes::Shape31>(L, "Set", &shapes::Shape31::Set);
+}
+
+void UnregisterStaticLuaProperties_Classes3_h() 
+{
+}
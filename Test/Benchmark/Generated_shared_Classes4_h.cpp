@@ -0,0 +1,177 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+#include <lab/Thunk.h>
+#include "Classes4.h"
+
+void RegisterAPIs_Classes4_h(luaportal::LuaState& LOL) 
+{
+	LOL.GlobalContext()
+	.BeginNamespace("shapes")
+	.BeginClass<shapes::Shape32>("Shape32")
+	.AddData("Value", &shapes::Shape32::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape33>("Shape33")
+	.AddData("Value", &shapes::Shape33::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape34>("Shape34")
+	.AddData("Value", &shapes::Shape34::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape35>("Shape35")
+	.AddData("Value", &shapes::Shape35::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape36>("Shape36")
+	.AddData("Value", &shapes::Shape36::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape37>("Shape37")
+	.AddData("Value", &shapes::Shape37::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape38>("Shape38")
+	.AddData("Value", &shapes::Shape38::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape39>("Shape39")
+	.AddData("Value", &shapes::Shape39::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape40>("Shape40")
+	.AddData("Value", &shapes::Shape40::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape41>("Shape41")
+	.AddData("Value", &shapes::Shape41::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape42>("Shape42")
+	.AddData("Value", &shapes::Shape42::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape43>("Shape43")
+	.AddData("Value", &shapes::Shape43::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape44>("Shape44")
+	.AddData("Value", &shapes::Shape44::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape45>("Shape45")
+	.AddData("Value", &shapes::Shape45::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape46>("Shape46")
+	.AddData("Value", &shapes::Shape46::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape47>("Shape47")
+	.AddData("Value", &shapes::Shape47::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape48>("Shape48")
+	.AddData("Value", &shapes::Shape48::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape49>("Shape49")
+	.AddData("Value", &shapes::Shape49::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape50>("Shape50")
+	.AddData("Value", &shapes::Shape50::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape51>("Shape51")
+	.AddData("Value", &shapes::Shape51::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape52>("Shape52")
+	.AddData("Value", &shapes::Shape52::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape53>("Shape53")
+	.AddData("Value", &shapes::Shape53::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape54>("Shape54")
+	.AddData("Value", &shapes::Shape54::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape55>("Shape55")
+	.AddData("Value", &shapes::Shape55::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape56>("Shape56")
+	.AddData("Value", &shapes::Shape56::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape57>("Shape57")
+	.AddData("Value", &shapes::Shape57::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape58>("Shape58")
+	.AddData("Value", &shapes::Shape58::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape59>("Shape59")
+	.AddData("Value", &shapes::Shape59::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape60>("Shape60")
+	.AddData("Value", &shapes::Shape60::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape61>("Shape61")
+	.AddData("Value", &shapes::Shape61::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape62>("Shape62")
+	.AddData("Value", &shapes::Shape62::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape63>("Shape63")
+	.AddData("Value", &shapes::Shape63::Value, true)
+	.EndClass()
+	.EndNamespace()
+	;
+	lua_State* L = lab::portal::GetState(LOL);
+	lab::BindMethod<shapes::Shape32>(L, "Get", &shapes::Shape32::Get);
+	lab::BindMethod<shapes::Shape32>(L, "Set", &shapes::Shape32::Set);
+	lab::BindMethod<shapes::Shape33>(L, "Get", &shapes::Shape33::Get);
+	lab::BindMethod<shapes::Shape33>(L, "Set", &shapes::Shape33::Set);
+	lab::BindMethod<shapes::Shape34>(L, "Get", &shapes::Shape34::Get);
+	lab::BindMethod<shapes::Shape34>(L, "Set", &shapes::Shape34::Set);
+	lab::BindMethod<shapes::Shape35>(L, "Get", &shapes::Shape35::Get);
+	lab::BindMethod<shapes::Shape35>(L, "Set", &shapes::Shape35::Set);
+	lab::BindMethod<shapes::Shape36>(L, "Get", &shapes::Shape36::Get);
+	lab::BindMethod<shapes::Shape36>(L, "Set", &shapes::Shape36::Set);
+	lab::BindMethod<shapes::Shape37>(L, "Get", &shapes::Shape37::Get);
+	lab::BindMethod<shapes::Shape37>(L, "Set", &shapes::Shape37::Set);
+	lab::BindMethod<shapes::Shape38>(L, "Get", &shapes::Shape38::Get);
+	lab::BindMethod<shapes::Shape38>(L, "Set", &shapes::Shape38::Set);
+	lab::BindMethod<shapes::Shape39>(L, "Get", &shapes::Shape39::Get);
+	lab::BindMethod<shapes::Shape39>(L, "Set", &shapes::Shape39::Set);
+	lab::BindMethod<shapes::Shape40>(L, "Get", &shapes::Shape40::Get);
+	lab::BindMethod<shapes::Shape40>(L, "Set", &shapes::Shape40::Set);
+	lab::BindMethod<shapes::Shape41>(L, "Get", &shapes::Shape41::Get);
+	lab::BindMethod<shapes::Shape41>(L, "Set", &shapes::Shape41::Set);
+	lab::BindMethod<shapes::Shape42>(L, "Get", &shapes::Shape42::Get);
+	lab::BindMethod<shapes::Shape42>(L, "Set", &shapes::Shape42::Set);
+	lab::BindMethod<shapes::Shape43>(L, "Get", &shapes::Shape43::Get);
+	lab::BindMethod<shapes::Shape43>(L, "Set", &shapes::Shape43::Set);
+	lab::BindMethod<shapes::Shape44>(L, "Get", &shapes::Shape44::Get);
+	lab::BindMethod<shapes::Shape44>(L, "Set", &shapes::Shape44::Set);
+	lab::BindMethod<shapes::Shape45>(L, "Get", &shapes::Shape45::Get);
+	lab::BindMethod<shapes::Shape45>(L, "Set", &shapes::Shape45::Set);
+	lab::BindMethod<shapes::Shape46>(L, "Get", &shapes::Shape46::Get);
+	lab::BindMethod<shapes::Shape46>(L, "Set", &shapes::Shape46::Set);
+	lab::BindMethod<shapes::Shape47>(L, "Get", &shapes::Shape47::Get);
+	lab::BindMethod<shapes::Shape47>(L, "Set", &shapes::Shape47::Set);
+	lab::BindMethod<shapes::Shape48>(L, "Get", &shapes::Shape48::Get);
+	lab::BindMethod<shapes::Shape48>(L, "Set", &shapes::Shape48::Set);
+	lab::BindMethod<shapes::Shape49>(L, "Get", &shapes::Shape49::Get);
+	lab::BindMethod<shapes::Shape49>(L, "Set", &shapes::Shape49::Set);
+	lab::BindMethod<shapes::Shape50>(L, "Get", &shapes::Shape50::Get);
+	lab::BindMethod<shapes::Shape50>(L, "Set", &shapes::Shape50::Set);
+	lab::BindMethod<shapes::Shape51>(L, "Get", &shapes::Shape51::Get);
+	lab::BindMethod<shapes::Shape51>(L, "Set", &shapes::Shape51::Set);
+	lab::BindMethod<shapes::Shape52>(L, "Get", &shapes::Shape52::Get);
+	lab::BindMethod<shapes::Shape52>(L, "Set", &shapes::Shape52::Set);
+	lab::BindMethod<shapes::Shape53>(L, "Get", &shapes::Shape53::Get);
+	lab::BindMethod<shapes::Shape53>(L, "Set", &shapes::Shape53::Set);
+	lab::BindMethod<shapes::Shape54>(L, "Get", &shapes::Shape54::Get);
+	lab::BindMethod<shapes::Shape54>(L, "Set", &shapes::Shape54::Set);
+	lab::BindMethod<shapes::Shape55>(L, "Get", &shapes::Shape55::Get);
+	lab::BindMethod<shapes::Shape55>(L, "Set", &shapes::Shape55::Set);
+	lab::BindMethod<shapes::Shape56>(L, "Get", &shapes::Shape56::Get);
+	lab::BindMethod<shapes::Shape56>(L, "Set", &shapes::Shape56::Set);
+	lab::BindMethod<shapes::Shape57>(L, "Get", &shapes::Shape57::Get);
+	lab::BindMethod<shapes::Shape57>(L, "Set", &shapes::Shape57::Set);
+	lab::BindMethod<shapes::Shape58>(L, "Get", &shapes::Shape58::Get);
+	lab::BindMethod<shapes::Shape58>(L, "Set", &shapes::Shape58::Set);
+	lab::BindMethod<shapes::Shape59>(L, "Get", &shapes::Shape59::Get);
+	lab::BindMethod<shapes::Shape59>(L, "Set", &shapes::Shape59::Set);
+	lab::BindMethod<shapes::Shape60>(L, "Get", &shapes::Shape60::Get);
+	lab::BindMethod<shapes::Shape60>(L, "Set", &shapes::Shape60::Set);
+	lab::BindMethod<shapes::Shape61>(L, "Get", &shapes::Shape61::Get);
+	lab::BindMethod<shapes::Shape61>(L, "Set", &shapes::Shape61::Set);
+	lab::BindMethod<shapes::Shape62>(L, "Get", &shapes::Shape62::Get);
+	lab::BindMethod<shapes::Shape62>(L, "Set", &shapes::Shape62::Set);
+	lab::BindMethod<shapes::Shape63>(L, "Get", &shapes::Shape63::Get);
+	lab::BindMethod<shapes::Shape63>(L, "Set", &shapes::Shape63::Set);
+}
+
+void UnregisterStaticLuaProperties_Classes4_h() 
+{
+}
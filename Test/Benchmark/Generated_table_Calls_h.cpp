@@ -0,0 +1,206 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+#include <lab/Direct.h>
+#include "Calls.h"
+
+static int Thunk_Calls_h_bench__Add(lua_State* L)
+{
+	lua_pushinteger(L, static_cast<lua_Integer>(bench::Add(static_cast<int>(luaL_checkinteger(L, 1)), static_cast<int>(luaL_checkinteger(L, 2)))));
+	return 1;
+}
+
+static int Thunk_Calls_h_bench__Length(lua_State* L)
+{
+	lua_pushinteger(L, static_cast<lua_Integer>(bench::Length(lab::direct::ToString(L, 1))));
+	return 1;
+}
+
+static int Thunk_Calls_h_bench__Counter__Twice(lua_State* L)
+{
+	lua_pushinteger(L, static_cast<lua_Integer>(bench::Counter::Twice(static_cast<int>(luaL_checkinteger(L, 1)))));
+	return 1;
+}
+
+static int Thunk_Calls_h_bench__Counter__Arg0(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<bench::Counter>(L, 1, false);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Arg0()));
+	return 1;
+}
+
+static int Thunk_Calls_h_bench__Counter__Arg1(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<bench::Counter>(L, 1, false);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Arg1(static_cast<int>(luaL_checkinteger(L, 2)))));
+	return 1;
+}
+
+static int Thunk_Calls_h_bench__Counter__Arg2(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<bench::Counter>(L, 1, false);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Arg2(static_cast<int>(luaL_checkinteger(L, 2)), static_cast<int>(luaL_checkinteger(L, 3)))));
+	return 1;
+}
+
+static int Thunk_Calls_h_bench__Counter__Arg3(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<bench::Counter>(L, 1, false);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Arg3(static_cast<int>(luaL_checkinteger(L, 2)), static_cast<int>(luaL_checkinteger(L, 3)), static_cast<int>(luaL_checkinteger(L, 4)))));
+	return 1;
+}
+
+static int Thunk_Calls_h_bench__Counter__Arg4(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<bench::Counter>(L, 1, false);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Arg4(static_cast<int>(luaL_checkinteger(L, 2)), static_cast<int>(luaL_checkinteger(L, 3)), static_cast<int>(luaL_checkinteger(L, 4)), static_cast<int>(luaL_checkinteger(L, 5)))));
+	return 1;
+}
+
+static int Thunk_Calls_h_bench__Counter__Arg5(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<bench::Counter>(L, 1, false);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Arg5(static_cast<int>(luaL_checkinteger(L, 2)), static_cast<int>(luaL_checkinteger(L, 3)), static_cast<int>(luaL_checkinteger(L, 4)), static_cast<int>(luaL_checkinteger(L, 5)), static_cast<int>(luaL_checkinteger(L, 6)))));
+	return 1;
+}
+
+static int Thunk_Calls_h_bench__Counter__Arg6(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<bench::Counter>(L, 1, false);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Arg6(static_cast<int>(luaL_checkinteger(L, 2)), static_cast<int>(luaL_checkinteger(L, 3)), static_cast<int>(luaL_checkinteger(L, 4)), static_cast<int>(luaL_checkinteger(L, 5)), static_cast<int>(luaL_checkinteger(L, 6)), static_cast<int>(luaL_checkinteger(L, 7)))));
+	return 1;
+}
+
+static int Thunk_Calls_h_bench__Counter__Arg7(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<bench::Counter>(L, 1, false);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Arg7(static_cast<int>(luaL_checkinteger(L, 2)), static_cast<int>(luaL_checkinteger(L, 3)), static_cast<int>(luaL_checkinteger(L, 4)), static_cast<int>(luaL_checkinteger(L, 5)), static_cast<int>(luaL_checkinteger(L, 6)), static_cast<int>(luaL_checkinteger(L, 7)), static_cast<int>(luaL_checkinteger(L, 8)))));
+	return 1;
+}
+
+static int Thunk_Calls_h_bench__Counter__Arg8(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<bench::Counter>(L, 1, false);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Arg8(static_cast<int>(luaL_checkinteger(L, 2)), static_cast<int>(luaL_checkinteger(L, 3)), static_cast<int>(luaL_checkinteger(L, 4)), static_cast<int>(luaL_checkinteger(L, 5)), static_cast<int>(luaL_checkinteger(L, 6)), static_cast<int>(luaL_checkinteger(L, 7)), static_cast<int>(luaL_checkinteger(L, 8)), static_cast<int>(luaL_checkinteger(L, 9)))));
+	return 1;
+}
+
+static int Thunk_Calls_h_bench__Counter__GetValue(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<bench::Counter>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->GetValue()));
+	return 1;
+}
+
+static int Thunk_Calls_h_bench__Counter__GetValue_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<bench::Counter>(L, 1, false);
+	Self->SetValue(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Calls_h_bench__Counter__Self(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<bench::Counter>(L, 1, false);
+	lab::portal::Push(L, Self->Self());
+	return 1;
+}
+
+static int Thunk_Calls_h_bench__Counter__Copy(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<bench::Counter>(L, 1, true);
+	lab::portal::Push(L, Self->Copy());
+	return 1;
+}
+
+static int Thunk_Calls_h_bench__Middle__Depth(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<bench::Middle>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Depth()));
+	return 1;
+}
+
+static int Thunk_Calls_h_bench__Leaf__Height(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<bench::Leaf>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Height()));
+	return 1;
+}
+
+void RegisterAPIs_Calls_h(luaportal::LuaState& LOL) 
+{
+	LOL.GlobalContext()
+	.BeginNamespace("bench")
+	.BeginClass<bench::Counter>("Counter")
+	.Def(luaportal::Constructor<>())
+	.AddStaticCFunction("Raw", &bench::Counter::Raw)
+	.AddData("Data", &bench::Counter::Data, true)
+	.EndClass()
+	.DeriveClass<bench::Middle,bench::Counter>("Middle")
+	.EndClass()
+	.DeriveClass<bench::Leaf,bench::Middle>("Leaf")
+	.Def(luaportal::Constructor<>())
+	.EndClass()
+	.EndNamespace()
+	;
+	lua_State* L = lab::portal::GetState(LOL);
+	lab::BindCFunction(L, "bench", "Add", &Thunk_Calls_h_bench__Add);
+	lab::BindCFunction(L, "bench", "Length", &Thunk_Calls_h_bench__Length);
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Arg0", &Thunk_Calls_h_bench__Counter__Arg0 },
+			{ "Arg1", &Thunk_Calls_h_bench__Counter__Arg1 },
+			{ "Arg2", &Thunk_Calls_h_bench__Counter__Arg2 },
+			{ "Arg3", &Thunk_Calls_h_bench__Counter__Arg3 },
+			{ "Arg4", &Thunk_Calls_h_bench__Counter__Arg4 },
+			{ "Arg5", &Thunk_Calls_h_bench__Counter__Arg5 },
+			{ "Arg6", &Thunk_Calls_h_bench__Counter__Arg6 },
+			{ "Arg7", &Thunk_Calls_h_bench__Counter__Arg7 },
+			{ "Arg8", &Thunk_Calls_h_bench__Counter__Arg8 },
+			{ "Self", &Thunk_Calls_h_bench__Counter__Self },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<bench::Counter>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Copy", &Thunk_Calls_h_bench__Counter__Copy },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<bench::Counter>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<bench::Counter>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const luaL_Reg Statics[] = {
+			{ "Twice", &Thunk_Calls_h_bench__Counter__Twice },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<bench::Counter>(L, lab::ClassTable::Statics, Statics);
+		static const luaL_Reg ConstGetters[] = {
+			{ "Value", &Thunk_Calls_h_bench__Counter__GetValue },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<bench::Counter>(L, lab::ClassTable::Getters, ConstGetters);
+		lab::SetFunctions<bench::Counter>(L, lab::ClassTable::ConstGetters, ConstGetters);
+		static const luaL_Reg Setters[] = {
+			{ "Value", &Thunk_Calls_h_bench__Counter__GetValue_Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<bench::Counter>(L, lab::ClassTable::Setters, Setters);
+	}
+	{
+		static const luaL_Reg ConstMethods[] = {
+			{ "Depth", &Thunk_Calls_h_bench__Middle__Depth },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<bench::Middle>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<bench::Middle>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg ConstMethods[] = {
+			{ "Height", &Thunk_Calls_h_bench__Leaf__Height },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<bench::Leaf>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<bench::Leaf>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+}
+
+void UnregisterStaticLuaProperties_Calls_h() 
+{
+}
@@ -0,0 +1,137 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+#include <lab/Direct.h>
+#include "Classes0.h"
+
+static int Thunk_Classes0_h_shapes__Shape0__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape0>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes0_h_shapes__Shape0__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape0>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes0_h_shapes__Shape1__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape1>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes0_h_shapes__Shape1__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape1>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes0_h_shapes__Shape2__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape2>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes0_h_shapes__Shape2__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape2>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes0_h_shapes__Shape3__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape3>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes0_h_shapes__Shape3__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape3>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+void RegisterAPIs_Classes0_h(luaportal::LuaState& LOL) 
+{
+	LOL.GlobalContext()
+	.BeginNamespace("shapes")
+	.BeginClass<shapes::Shape0>("Shape0")
+	.AddData("Value", &shapes::Shape0::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape1>("Shape1")
+	.AddData("Value", &shapes::Shape1::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape2>("Shape2")
+	.AddData("Value", &shapes::Shape2::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape3>("Shape3")
+	.AddData("Value", &shapes::Shape3::Value, true)
+	.EndClass()
+	.EndNamespace()
+	;
+	lua_State* L = lab::portal::GetState(LOL);
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes0_h_shapes__Shape0__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape0>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes0_h_shapes__Shape0__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape0>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape0>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes0_h_shapes__Shape1__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape1>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes0_h_shapes__Shape1__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape1>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape1>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes0_h_shapes__Shape2__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape2>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes0_h_shapes__Shape2__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape2>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape2>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes0_h_shapes__Shape3__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape3>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes0_h_shapes__Shape3__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape3>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape3>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+}
+
+void UnregisterStaticLuaProperties_Classes0_h() 
+{
+}
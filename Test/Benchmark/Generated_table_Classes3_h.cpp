@@ -0,0 +1,497 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+#include <lab/Direct.h>
+#include "Classes3.h"
+
+static int Thunk_Classes3_h_shapes__Shape16__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape16>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape16__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape16>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape17__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape17>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape17__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape17>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape18__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape18>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape18__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape18>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape19__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape19>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape19__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape19>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape20__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape20>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape20__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape20>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape21__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape21>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape21__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape21>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape22__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape22>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape22__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape22>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape23__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape23>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape23__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape23>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape24__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape24>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape24__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape24>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape25__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape25>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape25__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape25>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape26__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape26>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape26__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape26>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape27__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape27>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape27__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape27>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape28__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape28>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape28__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape28>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape29__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape29>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape29__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape29>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape30__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape30>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape30__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape30>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape31__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape31>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape31__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape31>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+void RegisterAPIs_Classes3_h(luaportal::LuaState& LOL) 
+{
+	LOL.GlobalContext()
+	.BeginNamespace("shapes")
+	.BeginClass<shapes::Shape16>("Shape16")
+	.AddData("Value", &shapes::Shape16::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape17>("Shape17")
+	.AddData("Value", &shapes::Shape17::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape18>("Shape18")
+	.AddData("Value", &shapes::Shape18::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape19>("Shape19")
+	.AddData("Value", &shapes::Shape19::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape20>("Shape20")
+	.AddData("Value", &shapes::Shape20::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape21>("Shape21")
+	.AddData("Value", &shapes::Shape21::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape22>("Shape22")
+	.AddData("Value", &shapes::Shape22::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape23>("Shape23")
+	.AddData("Value", &shapes::Shape23::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape24>("Shape24")
+	.AddData("Value", &shapes::Shape24::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape25>("Shape25")
+	.AddData("Value", &shapes::Shape25::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape26>("Shape26")
+	.AddData("Value", &shapes::Shape26::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape27>("Shape27")
+	.AddData("Value", &shapes::Shape27::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape28>("Shape28")
+	.AddData("Value", &shapes::Shape28::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape29>("Shape29")
+	.AddData("Value", &shapes::Shape29::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape30>("Shape30")
+	.AddData("Value", &shapes::Shape30::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape31>("Shape31")
+	.AddData("Value", &shapes::Shape31::Value, true)
+	.EndClass()
+	.EndNamespace()
+	;
+	lua_State* L = lab::portal::GetState(LOL);
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape16__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape16>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape16__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape16>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape16>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape17__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape17>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape17__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape17>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape17>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape18__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape18>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape18__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape18>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape18>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape19__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape19>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape19__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape19>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape19>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape20__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape20>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape20__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape20>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape20>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape21__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape21>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape21__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape21>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape21>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape22__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape22>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape22__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape22>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape22>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape23__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape23>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape23__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape23>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape23>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape24__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape24>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape24__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape24>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape24>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape25__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape25>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape25__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape25>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape25>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape26__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape26>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape26__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape26>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape26>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape27__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape27>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape27__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape27>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape27>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape28__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape28>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape28__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape28>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape28>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape29__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape29>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape29__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape29>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape29>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape30__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape30>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape30__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape30>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape30>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape31__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape31>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape31__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape31>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape31>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+}
+
+void UnregisterStaticLuaProperties_Classes3_h() 
+{
+}
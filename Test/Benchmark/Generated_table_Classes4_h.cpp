@@ -0,0 +1,977 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+#include <lab/Direct.h>
+#include "Classes4.h"
+
+static int Thunk_Classes4_h_shapes__Shape32__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape32>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape32__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape32>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape33__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape33>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape33__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape33>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape34__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape34>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape34__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape34>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape35__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape35>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape35__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape35>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape36__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape36>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape36__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape36>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape37__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape37>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape37__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape37>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape38__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape38>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape38__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape38>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape39__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape39>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape39__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape39>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape40__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape40>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape40__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape40>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape41__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape41>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape41__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape41>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape42__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape42>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape42__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape42>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape43__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape43>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape43__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape43>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape44__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape44>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape44__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape44>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape45__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape45>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape45__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape45>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape46__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape46>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape46__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape46>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape47__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape47>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape47__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape47>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape48__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape48>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape48__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape48>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape49__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape49>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape49__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape49>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape50__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape50>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape50__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape50>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape51__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape51>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape51__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape51>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape52__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape52>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape52__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape52>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape53__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape53>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape53__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape53>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape54__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape54>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape54__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape54>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape55__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape55>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape55__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape55>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape56__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape56>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape56__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape56>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape57__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape57>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape57__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape57>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape58__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape58>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape58__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape58>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape59__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape59>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape59__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape59>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape60__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape60>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape60__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape60>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape61__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape61>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape61__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape61>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape62__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape62>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape62__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape62>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape63__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape63>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape63__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape63>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+void RegisterAPIs_Classes4_h(luaportal::LuaState& LOL) 
+{
+	LOL.GlobalContext()
+	.BeginNamespace("shapes")
+	.BeginClass<shapes::Shape32>("Shape32")
+	.AddData("Value", &shapes::Shape32::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape33>("Shape33")
+	.AddData("Value", &shapes::Shape33::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape34>("Shape34")
+	.AddData("Value", &shapes::Shape34::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape35>("Shape35")
+	.AddData("Value", &shapes::Shape35::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape36>("Shape36")
+	.AddData("Value", &shapes::Shape36::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape37>("Shape37")
+	.AddData("Value", &shapes::Shape37::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape38>("Shape38")
+	.AddData("Value", &shapes::Shape38::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape39>("Shape39")
+	.AddData("Value", &shapes::Shape39::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape40>("Shape40")
+	.AddData("Value", &shapes::Shape40::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape41>("Shape41")
+	.AddData("Value", &shapes::Shape41::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape42>("Shape42")
+	.AddData("Value", &shapes::Shape42::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape43>("Shape43")
+	.AddData("Value", &shapes::Shape43::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape44>("Shape44")
+	.AddData("Value", &shapes::Shape44::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape45>("Shape45")
+	.AddData("Value", &shapes::Shape45::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape46>("Shape46")
+	.AddData("Value", &shapes::Shape46::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape47>("Shape47")
+	.AddData("Value", &shapes::Shape47::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape48>("Shape48")
+	.AddData("Value", &shapes::Shape48::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape49>("Shape49")
+	.AddData("Value", &shapes::Shape49::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape50>("Shape50")
+	.AddData("Value", &shapes::Shape50::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape51>("Shape51")
+	.AddData("Value", &shapes::Shape51::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape52>("Shape52")
+	.AddData("Value", &shapes::Shape52::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape53>("Shape53")
+	.AddData("Value", &shapes::Shape53::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape54>("Shape54")
+	.AddData("Value", &shapes::Shape54::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape55>("Shape55")
+	.AddData("Value", &shapes::Shape55::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape56>("Shape56")
+	.AddData("Value", &shapes::Shape56::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape57>("Shape57")
+	.AddData("Value", &shapes::Shape57::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape58>("Shape58")
+	.AddData("Value", &shapes::Shape58::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape59>("Shape59")
+	.AddData("Value", &shapes::Shape59::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape60>("Shape60")
+	.AddData("Value", &shapes::Shape60::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape61>("Shape61")
+	.AddData("Value", &shapes::Shape61::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape62>("Shape62")
+	.AddData("Value", &shapes::Shape62::Value, true)
+	.EndClass()
+	.BeginClass<shapes::Shape63>("Shape63")
+	.AddData("Value", &shapes::Shape63::Value, true)
+	.EndClass()
+	.EndNamespace()
+	;
+	lua_State* L = lab::portal::GetState(LOL);
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape32__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape32>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape32__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape32>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape32>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape33__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape33>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape33__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape33>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape33>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape34__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape34>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape34__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape34>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape34>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape35__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape35>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape35__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape35>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape35>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape36__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape36>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape36__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape36>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape36>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape37__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape37>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape37__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape37>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape37>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape38__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape38>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape38__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape38>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape38>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape39__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape39>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape39__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape39>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape39>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape40__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape40>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape40__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape40>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape40>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape41__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape41>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape41__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape41>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape41>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape42__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape42>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape42__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape42>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape42>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape43__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape43>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape43__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape43>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape43>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape44__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape44>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape44__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape44>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape44>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape45__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape45>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape45__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape45>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape45>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape46__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape46>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape46__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape46>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape46>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape47__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape47>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape47__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape47>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape47>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape48__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape48>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape48__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape48>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape48>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape49__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape49>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape49__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape49>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape49>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape50__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape50>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape50__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape50>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape50>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape51__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape51>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape51__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape51>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape51>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape52__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape52>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape52__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape52>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape52>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape53__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape53>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape53__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape53>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape53>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape54__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape54>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape54__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape54>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape54>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape55__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape55>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape55__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape55>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape55>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape56__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape56>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape56__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape56>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape56>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape57__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape57>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape57__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape57>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape57>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape58__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape58>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape58__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape58>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape58>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape59__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape59>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape59__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape59>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape59>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape60__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape60>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape60__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape60>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape60>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape61__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape61>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape61__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape61>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape61>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape62__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape62>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape62__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape62>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape62>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape63__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape63>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape63__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape63>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape63>(L, lab::ClassTable::ConstMethods, ConstMethods);
+	}
+}
+
+void UnregisterStaticLuaProperties_Classes4_h() 
+{
+}
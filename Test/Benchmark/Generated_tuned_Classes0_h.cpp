@@ -0,0 +1,269 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+#include <lab/Dispatch.h>
+#include <lab/Field.h>
+#include <lab/Identity.h>
+#include <lab/Enum.h>
+#include <lab/Inherit.h>
+#include "Classes0.h"
+
+static int Thunk_Classes0_h_shapes__Shape0__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape0>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes0_h_shapes__Shape0__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape0>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes0_h_shapes__Shape0__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape0>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes0_h_shapes__Shape0__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape0>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes0_h_shapes__Shape1__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape1>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes0_h_shapes__Shape1__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape1>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes0_h_shapes__Shape1__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape1>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes0_h_shapes__Shape1__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape1>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes0_h_shapes__Shape2__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape2>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes0_h_shapes__Shape2__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape2>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes0_h_shapes__Shape2__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape2>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes0_h_shapes__Shape2__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape2>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes0_h_shapes__Shape3__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape3>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes0_h_shapes__Shape3__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape3>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes0_h_shapes__Shape3__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape3>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes0_h_shapes__Shape3__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape3>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+void RegisterAPIs_Classes0_h(luaportal::LuaState& LOL) 
+{
+	LOL.GlobalContext()
+	.BeginNamespace("shapes")
+	.BeginClass<shapes::Shape0>("Shape0")
+	.EndClass()
+	.BeginClass<shapes::Shape1>("Shape1")
+	.EndClass()
+	.BeginClass<shapes::Shape2>("Shape2")
+	.EndClass()
+	.BeginClass<shapes::Shape3>("Shape3")
+	.EndClass()
+	.EndNamespace()
+	;
+	lua_State* L = lab::portal::GetState(LOL);
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape0, decltype(shapes::Shape0::Value), &shapes::Shape0::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape0>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes0_h_shapes__Shape0__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape0>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes0_h_shapes__Shape0__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape0>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape0>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes0_h_shapes__Shape0__Value, &Thunk_Classes0_h_shapes__Shape0__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes0_h_shapes__Shape0__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes0_h_shapes__Shape0__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes0_h_shapes__Shape0__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes0_h_shapes__Shape0__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape0>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape1, decltype(shapes::Shape1::Value), &shapes::Shape1::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape1>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes0_h_shapes__Shape1__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape1>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes0_h_shapes__Shape1__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape1>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape1>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes0_h_shapes__Shape1__Value, &Thunk_Classes0_h_shapes__Shape1__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes0_h_shapes__Shape1__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes0_h_shapes__Shape1__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes0_h_shapes__Shape1__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes0_h_shapes__Shape1__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape1>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape2, decltype(shapes::Shape2::Value), &shapes::Shape2::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape2>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes0_h_shapes__Shape2__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape2>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes0_h_shapes__Shape2__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape2>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape2>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes0_h_shapes__Shape2__Value, &Thunk_Classes0_h_shapes__Shape2__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes0_h_shapes__Shape2__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes0_h_shapes__Shape2__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes0_h_shapes__Shape2__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes0_h_shapes__Shape2__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape2>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape3, decltype(shapes::Shape3::Value), &shapes::Shape3::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape3>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes0_h_shapes__Shape3__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape3>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes0_h_shapes__Shape3__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape3>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape3>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes0_h_shapes__Shape3__Value, &Thunk_Classes0_h_shapes__Shape3__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes0_h_shapes__Shape3__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes0_h_shapes__Shape3__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes0_h_shapes__Shape3__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes0_h_shapes__Shape3__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape3>(L, &Table, &ConstTable);
+	}
+}
+
+void UnregisterStaticLuaProperties_Classes0_h() 
+{
+}
@@ -0,0 +1,269 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+#include <lab/Dispatch.h>
+#include <lab/Field.h>
+#include <lab/Identity.h>
+#include <lab/Enum.h>
+#include <lab/Inherit.h>
+#include "Classes1.h"
+
+static int Thunk_Classes1_h_shapes__Shape4__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape4>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes1_h_shapes__Shape4__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape4>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes1_h_shapes__Shape4__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape4>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes1_h_shapes__Shape4__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape4>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes1_h_shapes__Shape5__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape5>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes1_h_shapes__Shape5__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape5>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes1_h_shapes__Shape5__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape5>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes1_h_shapes__Shape5__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape5>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes1_h_shapes__Shape6__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape6>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes1_h_shapes__Shape6__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape6>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes1_h_shapes__Shape6__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape6>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes1_h_shapes__Shape6__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape6>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes1_h_shapes__Shape7__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape7>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes1_h_shapes__Shape7__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape7>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes1_h_shapes__Shape7__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape7>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes1_h_shapes__Shape7__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape7>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+void RegisterAPIs_Classes1_h(luaportal::LuaState& LOL) 
+{
+	LOL.GlobalContext()
+	.BeginNamespace("shapes")
+	.BeginClass<shapes::Shape4>("Shape4")
+	.EndClass()
+	.BeginClass<shapes::Shape5>("Shape5")
+	.EndClass()
+	.BeginClass<shapes::Shape6>("Shape6")
+	.EndClass()
+	.BeginClass<shapes::Shape7>("Shape7")
+	.EndClass()
+	.EndNamespace()
+	;
+	lua_State* L = lab::portal::GetState(LOL);
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape4, decltype(shapes::Shape4::Value), &shapes::Shape4::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape4>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes1_h_shapes__Shape4__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape4>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes1_h_shapes__Shape4__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape4>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape4>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes1_h_shapes__Shape4__Value, &Thunk_Classes1_h_shapes__Shape4__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes1_h_shapes__Shape4__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes1_h_shapes__Shape4__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes1_h_shapes__Shape4__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes1_h_shapes__Shape4__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape4>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape5, decltype(shapes::Shape5::Value), &shapes::Shape5::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape5>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes1_h_shapes__Shape5__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape5>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes1_h_shapes__Shape5__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape5>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape5>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes1_h_shapes__Shape5__Value, &Thunk_Classes1_h_shapes__Shape5__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes1_h_shapes__Shape5__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes1_h_shapes__Shape5__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes1_h_shapes__Shape5__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes1_h_shapes__Shape5__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape5>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape6, decltype(shapes::Shape6::Value), &shapes::Shape6::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape6>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes1_h_shapes__Shape6__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape6>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes1_h_shapes__Shape6__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape6>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape6>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes1_h_shapes__Shape6__Value, &Thunk_Classes1_h_shapes__Shape6__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes1_h_shapes__Shape6__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes1_h_shapes__Shape6__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes1_h_shapes__Shape6__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes1_h_shapes__Shape6__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape6>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape7, decltype(shapes::Shape7::Value), &shapes::Shape7::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape7>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes1_h_shapes__Shape7__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape7>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes1_h_shapes__Shape7__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape7>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape7>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes1_h_shapes__Shape7__Value, &Thunk_Classes1_h_shapes__Shape7__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes1_h_shapes__Shape7__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes1_h_shapes__Shape7__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes1_h_shapes__Shape7__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes1_h_shapes__Shape7__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape7>(L, &Table, &ConstTable);
+	}
+}
+
+void UnregisterStaticLuaProperties_Classes1_h() 
+{
+}
@@ -0,0 +1,517 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+#include <lab/Dispatch.h>
+#include <lab/Field.h>
+#include <lab/Identity.h>
+#include <lab/Enum.h>
+#include <lab/Inherit.h>
+#include "Classes2.h"
+
+static int Thunk_Classes2_h_shapes__Shape8__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape8>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape8__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape8>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes2_h_shapes__Shape8__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape8>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape8__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape8>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes2_h_shapes__Shape9__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape9>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape9__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape9>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes2_h_shapes__Shape9__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape9>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape9__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape9>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes2_h_shapes__Shape10__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape10>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape10__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape10>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes2_h_shapes__Shape10__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape10>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape10__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape10>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes2_h_shapes__Shape11__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape11>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape11__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape11>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes2_h_shapes__Shape11__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape11>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape11__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape11>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes2_h_shapes__Shape12__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape12>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape12__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape12>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes2_h_shapes__Shape12__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape12>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape12__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape12>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes2_h_shapes__Shape13__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape13>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape13__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape13>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes2_h_shapes__Shape13__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape13>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape13__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape13>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes2_h_shapes__Shape14__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape14>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape14__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape14>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes2_h_shapes__Shape14__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape14>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape14__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape14>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes2_h_shapes__Shape15__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape15>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape15__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape15>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes2_h_shapes__Shape15__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape15>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes2_h_shapes__Shape15__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape15>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+void RegisterAPIs_Classes2_h(luaportal::LuaState& LOL) 
+{
+	LOL.GlobalContext()
+	.BeginNamespace("shapes")
+	.BeginClass<shapes::Shape8>("Shape8")
+	.EndClass()
+	.BeginClass<shapes::Shape9>("Shape9")
+	.EndClass()
+	.BeginClass<shapes::Shape10>("Shape10")
+	.EndClass()
+	.BeginClass<shapes::Shape11>("Shape11")
+	.EndClass()
+	.BeginClass<shapes::Shape12>("Shape12")
+	.EndClass()
+	.BeginClass<shapes::Shape13>("Shape13")
+	.EndClass()
+	.BeginClass<shapes::Shape14>("Shape14")
+	.EndClass()
+	.BeginClass<shapes::Shape15>("Shape15")
+	.EndClass()
+	.EndNamespace()
+	;
+	lua_State* L = lab::portal::GetState(LOL);
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape8, decltype(shapes::Shape8::Value), &shapes::Shape8::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape8>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes2_h_shapes__Shape8__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape8>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes2_h_shapes__Shape8__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape8>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape8>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes2_h_shapes__Shape8__Value, &Thunk_Classes2_h_shapes__Shape8__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes2_h_shapes__Shape8__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes2_h_shapes__Shape8__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes2_h_shapes__Shape8__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes2_h_shapes__Shape8__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape8>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape9, decltype(shapes::Shape9::Value), &shapes::Shape9::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape9>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes2_h_shapes__Shape9__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape9>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes2_h_shapes__Shape9__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape9>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape9>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes2_h_shapes__Shape9__Value, &Thunk_Classes2_h_shapes__Shape9__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes2_h_shapes__Shape9__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes2_h_shapes__Shape9__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes2_h_shapes__Shape9__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes2_h_shapes__Shape9__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape9>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape10, decltype(shapes::Shape10::Value), &shapes::Shape10::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape10>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes2_h_shapes__Shape10__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape10>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes2_h_shapes__Shape10__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape10>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape10>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes2_h_shapes__Shape10__Value, &Thunk_Classes2_h_shapes__Shape10__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes2_h_shapes__Shape10__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes2_h_shapes__Shape10__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes2_h_shapes__Shape10__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes2_h_shapes__Shape10__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape10>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape11, decltype(shapes::Shape11::Value), &shapes::Shape11::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape11>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes2_h_shapes__Shape11__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape11>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes2_h_shapes__Shape11__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape11>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape11>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes2_h_shapes__Shape11__Value, &Thunk_Classes2_h_shapes__Shape11__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes2_h_shapes__Shape11__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes2_h_shapes__Shape11__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes2_h_shapes__Shape11__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes2_h_shapes__Shape11__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape11>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape12, decltype(shapes::Shape12::Value), &shapes::Shape12::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape12>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes2_h_shapes__Shape12__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape12>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes2_h_shapes__Shape12__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape12>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape12>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes2_h_shapes__Shape12__Value, &Thunk_Classes2_h_shapes__Shape12__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes2_h_shapes__Shape12__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes2_h_shapes__Shape12__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes2_h_shapes__Shape12__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes2_h_shapes__Shape12__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape12>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape13, decltype(shapes::Shape13::Value), &shapes::Shape13::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape13>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes2_h_shapes__Shape13__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape13>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes2_h_shapes__Shape13__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape13>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape13>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes2_h_shapes__Shape13__Value, &Thunk_Classes2_h_shapes__Shape13__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes2_h_shapes__Shape13__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes2_h_shapes__Shape13__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes2_h_shapes__Shape13__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes2_h_shapes__Shape13__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape13>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape14, decltype(shapes::Shape14::Value), &shapes::Shape14::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape14>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes2_h_shapes__Shape14__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape14>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes2_h_shapes__Shape14__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape14>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape14>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes2_h_shapes__Shape14__Value, &Thunk_Classes2_h_shapes__Shape14__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes2_h_shapes__Shape14__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes2_h_shapes__Shape14__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes2_h_shapes__Shape14__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes2_h_shapes__Shape14__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape14>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape15, decltype(shapes::Shape15::Value), &shapes::Shape15::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape15>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes2_h_shapes__Shape15__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape15>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes2_h_shapes__Shape15__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape15>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape15>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes2_h_shapes__Shape15__Value, &Thunk_Classes2_h_shapes__Shape15__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes2_h_shapes__Shape15__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes2_h_shapes__Shape15__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes2_h_shapes__Shape15__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes2_h_shapes__Shape15__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape15>(L, &Table, &ConstTable);
+	}
+}
+
+void UnregisterStaticLuaProperties_Classes2_h() 
+{
+}
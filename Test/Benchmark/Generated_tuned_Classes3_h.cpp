@@ -0,0 +1,1013 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+#include <lab/Dispatch.h>
+#include <lab/Field.h>
+#include <lab/Identity.h>
+#include <lab/Enum.h>
+#include <lab/Inherit.h>
+#include "Classes3.h"
+
+static int Thunk_Classes3_h_shapes__Shape16__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape16>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape16__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape16>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape16__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape16>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape16__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape16>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape17__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape17>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape17__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape17>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape17__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape17>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape17__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape17>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape18__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape18>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape18__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape18>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape18__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape18>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape18__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape18>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape19__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape19>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape19__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape19>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape19__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape19>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape19__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape19>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape20__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape20>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape20__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape20>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape20__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape20>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape20__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape20>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape21__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape21>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape21__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape21>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape21__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape21>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape21__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape21>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape22__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape22>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape22__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape22>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape22__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape22>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape22__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape22>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape23__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape23>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape23__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape23>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape23__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape23>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape23__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape23>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape24__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape24>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape24__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape24>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape24__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape24>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape24__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape24>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape25__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape25>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape25__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape25>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape25__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape25>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape25__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape25>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape26__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape26>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape26__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape26>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape26__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape26>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape26__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape26>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape27__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape27>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape27__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape27>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape27__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape27>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape27__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape27>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape28__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape28>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape28__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape28>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape28__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape28>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape28__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape28>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape29__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape29>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape29__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape29>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape29__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape29>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape29__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape29>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape30__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape30>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape30__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape30>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape30__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape30>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape30__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape30>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape31__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape31>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape31__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape31>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes3_h_shapes__Shape31__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape31>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes3_h_shapes__Shape31__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape31>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+void RegisterAPIs_Classes3_h(luaportal::LuaState& LOL) 
+{
+	LOL.GlobalContext()
+	.BeginNamespace("shapes")
+	.BeginClass<shapes::Shape16>("Shape16")
+	.EndClass()
+	.BeginClass<shapes::Shape17>("Shape17")
+	.EndClass()
+	.BeginClass<shapes::Shape18>("Shape18")
+	.EndClass()
+	.BeginClass<shapes::Shape19>("Shape19")
+	.EndClass()
+	.BeginClass<shapes::Shape20>("Shape20")
+	.EndClass()
+	.BeginClass<shapes::Shape21>("Shape21")
+	.EndClass()
+	.BeginClass<shapes::Shape22>("Shape22")
+	.EndClass()
+	.BeginClass<shapes::Shape23>("Shape23")
+	.EndClass()
+	.BeginClass<shapes::Shape24>("Shape24")
+	.EndClass()
+	.BeginClass<shapes::Shape25>("Shape25")
+	.EndClass()
+	.BeginClass<shapes::Shape26>("Shape26")
+	.EndClass()
+	.BeginClass<shapes::Shape27>("Shape27")
+	.EndClass()
+	.BeginClass<shapes::Shape28>("Shape28")
+	.EndClass()
+	.BeginClass<shapes::Shape29>("Shape29")
+	.EndClass()
+	.BeginClass<shapes::Shape30>("Shape30")
+	.EndClass()
+	.BeginClass<shapes::Shape31>("Shape31")
+	.EndClass()
+	.EndNamespace()
+	;
+	lua_State* L = lab::portal::GetState(LOL);
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape16, decltype(shapes::Shape16::Value), &shapes::Shape16::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape16>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape16__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape16>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape16__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape16>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape16>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape16__Value, &Thunk_Classes3_h_shapes__Shape16__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape16__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape16__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape16__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape16__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape16>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape17, decltype(shapes::Shape17::Value), &shapes::Shape17::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape17>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape17__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape17>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape17__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape17>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape17>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape17__Value, &Thunk_Classes3_h_shapes__Shape17__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape17__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape17__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape17__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape17__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape17>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape18, decltype(shapes::Shape18::Value), &shapes::Shape18::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape18>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape18__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape18>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape18__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape18>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape18>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape18__Value, &Thunk_Classes3_h_shapes__Shape18__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape18__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape18__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape18__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape18__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape18>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape19, decltype(shapes::Shape19::Value), &shapes::Shape19::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape19>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape19__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape19>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape19__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape19>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape19>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape19__Value, &Thunk_Classes3_h_shapes__Shape19__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape19__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape19__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape19__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape19__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape19>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape20, decltype(shapes::Shape20::Value), &shapes::Shape20::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape20>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape20__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape20>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape20__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape20>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape20>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape20__Value, &Thunk_Classes3_h_shapes__Shape20__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape20__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape20__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape20__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape20__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape20>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape21, decltype(shapes::Shape21::Value), &shapes::Shape21::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape21>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape21__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape21>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape21__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape21>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape21>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape21__Value, &Thunk_Classes3_h_shapes__Shape21__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape21__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape21__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape21__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape21__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape21>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape22, decltype(shapes::Shape22::Value), &shapes::Shape22::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape22>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape22__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape22>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape22__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape22>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape22>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape22__Value, &Thunk_Classes3_h_shapes__Shape22__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape22__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape22__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape22__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape22__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape22>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape23, decltype(shapes::Shape23::Value), &shapes::Shape23::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape23>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape23__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape23>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape23__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape23>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape23>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape23__Value, &Thunk_Classes3_h_shapes__Shape23__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape23__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape23__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape23__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape23__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape23>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape24, decltype(shapes::Shape24::Value), &shapes::Shape24::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape24>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape24__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape24>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape24__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape24>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape24>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape24__Value, &Thunk_Classes3_h_shapes__Shape24__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape24__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape24__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape24__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape24__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape24>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape25, decltype(shapes::Shape25::Value), &shapes::Shape25::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape25>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape25__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape25>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape25__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape25>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape25>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape25__Value, &Thunk_Classes3_h_shapes__Shape25__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape25__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape25__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape25__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape25__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape25>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape26, decltype(shapes::Shape26::Value), &shapes::Shape26::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape26>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape26__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape26>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape26__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape26>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape26>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape26__Value, &Thunk_Classes3_h_shapes__Shape26__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape26__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape26__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape26__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape26__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape26>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape27, decltype(shapes::Shape27::Value), &shapes::Shape27::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape27>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape27__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape27>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape27__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape27>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape27>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape27__Value, &Thunk_Classes3_h_shapes__Shape27__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape27__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape27__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape27__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape27__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape27>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape28, decltype(shapes::Shape28::Value), &shapes::Shape28::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape28>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape28__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape28>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape28__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape28>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape28>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape28__Value, &Thunk_Classes3_h_shapes__Shape28__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape28__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape28__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape28__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape28__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape28>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape29, decltype(shapes::Shape29::Value), &shapes::Shape29::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape29>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape29__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape29>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape29__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape29>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape29>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape29__Value, &Thunk_Classes3_h_shapes__Shape29__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape29__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape29__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape29__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape29__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape29>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape30, decltype(shapes::Shape30::Value), &shapes::Shape30::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape30>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape30__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape30>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape30__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape30>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape30>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape30__Value, &Thunk_Classes3_h_shapes__Shape30__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape30__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape30__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape30__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape30__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape30>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape31, decltype(shapes::Shape31::Value), &shapes::Shape31::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape31>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes3_h_shapes__Shape31__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape31>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes3_h_shapes__Shape31__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape31>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape31>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape31__Value, &Thunk_Classes3_h_shapes__Shape31__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape31__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape31__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes3_h_shapes__Shape31__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes3_h_shapes__Shape31__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape31>(L, &Table, &ConstTable);
+	}
+}
+
+void UnregisterStaticLuaProperties_Classes3_h() 
+{
+}
@@ -0,0 +1,2005 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+#include <lab/Dispatch.h>
+#include <lab/Field.h>
+#include <lab/Identity.h>
+#include <lab/Enum.h>
+#include <lab/Inherit.h>
+#include "Classes4.h"
+
+static int Thunk_Classes4_h_shapes__Shape32__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape32>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape32__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape32>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape32__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape32>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape32__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape32>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape33__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape33>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape33__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape33>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape33__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape33>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape33__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape33>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape34__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape34>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape34__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape34>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape34__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape34>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape34__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape34>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape35__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape35>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape35__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape35>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape35__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape35>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape35__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape35>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape36__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape36>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape36__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape36>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape36__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape36>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape36__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape36>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape37__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape37>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape37__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape37>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape37__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape37>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape37__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape37>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape38__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape38>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape38__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape38>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape38__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape38>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape38__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape38>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape39__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape39>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape39__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape39>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape39__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape39>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape39__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape39>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape40__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape40>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape40__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape40>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape40__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape40>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape40__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape40>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape41__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape41>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape41__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape41>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape41__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape41>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape41__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape41>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape42__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape42>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape42__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape42>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape42__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape42>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape42__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape42>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape43__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape43>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape43__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape43>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape43__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape43>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape43__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape43>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape44__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape44>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape44__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape44>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape44__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape44>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape44__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape44>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape45__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape45>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape45__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape45>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape45__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape45>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape45__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape45>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape46__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape46>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape46__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape46>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape46__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape46>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape46__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape46>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape47__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape47>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape47__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape47>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape47__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape47>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape47__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape47>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape48__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape48>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape48__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape48>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape48__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape48>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape48__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape48>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape49__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape49>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape49__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape49>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape49__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape49>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape49__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape49>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape50__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape50>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape50__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape50>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape50__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape50>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape50__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape50>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape51__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape51>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape51__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape51>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape51__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape51>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape51__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape51>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape52__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape52>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape52__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape52>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape52__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape52>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape52__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape52>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape53__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape53>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape53__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape53>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape53__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape53>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape53__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape53>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape54__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape54>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape54__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape54>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape54__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape54>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape54__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape54>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape55__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape55>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape55__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape55>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape55__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape55>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape55__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape55>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape56__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape56>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape56__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape56>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape56__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape56>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape56__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape56>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape57__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape57>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape57__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape57>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape57__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape57>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape57__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape57>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape58__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape58>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape58__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape58>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape58__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape58>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape58__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape58>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape59__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape59>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape59__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape59>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape59__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape59>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape59__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape59>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape60__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape60>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape60__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape60>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape60__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape60>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape60__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape60>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape61__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape61>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape61__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape61>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape61__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape61>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape61__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape61>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape62__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape62>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape62__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape62>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape62__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape62>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape62__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape62>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape63__Get(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape63>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Get()));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape63__Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape63>(L, 1, false);
+	Self->Set(static_cast<int>(luaL_checkinteger(L, 2)));
+	return 0;
+}
+
+static int Thunk_Classes4_h_shapes__Shape63__Value(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape63>(L, 1, true);
+	lua_pushinteger(L, static_cast<lua_Integer>(Self->Value));
+	return 1;
+}
+
+static int Thunk_Classes4_h_shapes__Shape63__Value_Set(lua_State* L)
+{
+	auto Self = lab::portal::GetObject<shapes::Shape63>(L, 1, false);
+	Self->Value = static_cast<int>(luaL_checkinteger(L, 2));
+	return 0;
+}
+
+void RegisterAPIs_Classes4_h(luaportal::LuaState& LOL) 
+{
+	LOL.GlobalContext()
+	.BeginNamespace("shapes")
+	.BeginClass<shapes::Shape32>("Shape32")
+	.EndClass()
+	.BeginClass<shapes::Shape33>("Shape33")
+	.EndClass()
+	.BeginClass<shapes::Shape34>("Shape34")
+	.EndClass()
+	.BeginClass<shapes::Shape35>("Shape35")
+	.EndClass()
+	.BeginClass<shapes::Shape36>("Shape36")
+	.EndClass()
+	.BeginClass<shapes::Shape37>("Shape37")
+	.EndClass()
+	.BeginClass<shapes::Shape38>("Shape38")
+	.EndClass()
+	.BeginClass<shapes::Shape39>("Shape39")
+	.EndClass()
+	.BeginClass<shapes::Shape40>("Shape40")
+	.EndClass()
+	.BeginClass<shapes::Shape41>("Shape41")
+	.EndClass()
+	.BeginClass<shapes::Shape42>("Shape42")
+	.EndClass()
+	.BeginClass<shapes::Shape43>("Shape43")
+	.EndClass()
+	.BeginClass<shapes::Shape44>("Shape44")
+	.EndClass()
+	.BeginClass<shapes::Shape45>("Shape45")
+	.EndClass()
+	.BeginClass<shapes::Shape46>("Shape46")
+	.EndClass()
+	.BeginClass<shapes::Shape47>("Shape47")
+	.EndClass()
+	.BeginClass<shapes::Shape48>("Shape48")
+	.EndClass()
+	.BeginClass<shapes::Shape49>("Shape49")
+	.EndClass()
+	.BeginClass<shapes::Shape50>("Shape50")
+	.EndClass()
+	.BeginClass<shapes::Shape51>("Shape51")
+	.EndClass()
+	.BeginClass<shapes::Shape52>("Shape52")
+	.EndClass()
+	.BeginClass<shapes::Shape53>("Shape53")
+	.EndClass()
+	.BeginClass<shapes::Shape54>("Shape54")
+	.EndClass()
+	.BeginClass<shapes::Shape55>("Shape55")
+	.EndClass()
+	.BeginClass<shapes::Shape56>("Shape56")
+	.EndClass()
+	.BeginClass<shapes::Shape57>("Shape57")
+	.EndClass()
+	.BeginClass<shapes::Shape58>("Shape58")
+	.EndClass()
+	.BeginClass<shapes::Shape59>("Shape59")
+	.EndClass()
+	.BeginClass<shapes::Shape60>("Shape60")
+	.EndClass()
+	.BeginClass<shapes::Shape61>("Shape61")
+	.EndClass()
+	.BeginClass<shapes::Shape62>("Shape62")
+	.EndClass()
+	.BeginClass<shapes::Shape63>("Shape63")
+	.EndClass()
+	.EndNamespace()
+	;
+	lua_State* L = lab::portal::GetState(LOL);
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape32, decltype(shapes::Shape32::Value), &shapes::Shape32::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape32>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape32__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape32>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape32__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape32>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape32>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape32__Value, &Thunk_Classes4_h_shapes__Shape32__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape32__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape32__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape32__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape32__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape32>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape33, decltype(shapes::Shape33::Value), &shapes::Shape33::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape33>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape33__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape33>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape33__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape33>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape33>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape33__Value, &Thunk_Classes4_h_shapes__Shape33__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape33__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape33__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape33__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape33__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape33>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape34, decltype(shapes::Shape34::Value), &shapes::Shape34::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape34>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape34__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape34>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape34__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape34>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape34>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape34__Value, &Thunk_Classes4_h_shapes__Shape34__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape34__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape34__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape34__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape34__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape34>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape35, decltype(shapes::Shape35::Value), &shapes::Shape35::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape35>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape35__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape35>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape35__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape35>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape35>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape35__Value, &Thunk_Classes4_h_shapes__Shape35__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape35__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape35__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape35__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape35__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape35>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape36, decltype(shapes::Shape36::Value), &shapes::Shape36::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape36>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape36__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape36>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape36__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape36>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape36>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape36__Value, &Thunk_Classes4_h_shapes__Shape36__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape36__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape36__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape36__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape36__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape36>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape37, decltype(shapes::Shape37::Value), &shapes::Shape37::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape37>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape37__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape37>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape37__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape37>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape37>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape37__Value, &Thunk_Classes4_h_shapes__Shape37__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape37__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape37__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape37__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape37__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape37>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape38, decltype(shapes::Shape38::Value), &shapes::Shape38::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape38>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape38__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape38>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape38__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape38>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape38>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape38__Value, &Thunk_Classes4_h_shapes__Shape38__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape38__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape38__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape38__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape38__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape38>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape39, decltype(shapes::Shape39::Value), &shapes::Shape39::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape39>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape39__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape39>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape39__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape39>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape39>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape39__Value, &Thunk_Classes4_h_shapes__Shape39__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape39__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape39__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape39__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape39__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape39>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape40, decltype(shapes::Shape40::Value), &shapes::Shape40::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape40>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape40__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape40>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape40__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape40>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape40>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape40__Value, &Thunk_Classes4_h_shapes__Shape40__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape40__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape40__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape40__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape40__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape40>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape41, decltype(shapes::Shape41::Value), &shapes::Shape41::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape41>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape41__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape41>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape41__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape41>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape41>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape41__Value, &Thunk_Classes4_h_shapes__Shape41__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape41__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape41__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape41__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape41__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape41>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape42, decltype(shapes::Shape42::Value), &shapes::Shape42::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape42>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape42__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape42>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape42__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape42>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape42>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape42__Value, &Thunk_Classes4_h_shapes__Shape42__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape42__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape42__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape42__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape42__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape42>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape43, decltype(shapes::Shape43::Value), &shapes::Shape43::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape43>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape43__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape43>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape43__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape43>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape43>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape43__Value, &Thunk_Classes4_h_shapes__Shape43__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape43__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape43__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape43__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape43__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape43>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape44, decltype(shapes::Shape44::Value), &shapes::Shape44::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape44>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape44__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape44>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape44__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape44>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape44>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape44__Value, &Thunk_Classes4_h_shapes__Shape44__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape44__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape44__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape44__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape44__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape44>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape45, decltype(shapes::Shape45::Value), &shapes::Shape45::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape45>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape45__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape45>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape45__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape45>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape45>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape45__Value, &Thunk_Classes4_h_shapes__Shape45__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape45__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape45__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape45__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape45__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape45>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape46, decltype(shapes::Shape46::Value), &shapes::Shape46::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape46>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape46__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape46>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape46__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape46>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape46>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape46__Value, &Thunk_Classes4_h_shapes__Shape46__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape46__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape46__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape46__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape46__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape46>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape47, decltype(shapes::Shape47::Value), &shapes::Shape47::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape47>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape47__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape47>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape47__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape47>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape47>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape47__Value, &Thunk_Classes4_h_shapes__Shape47__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape47__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape47__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape47__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape47__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape47>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape48, decltype(shapes::Shape48::Value), &shapes::Shape48::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape48>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape48__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape48>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape48__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape48>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape48>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape48__Value, &Thunk_Classes4_h_shapes__Shape48__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape48__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape48__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape48__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape48__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape48>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape49, decltype(shapes::Shape49::Value), &shapes::Shape49::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape49>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape49__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape49>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape49__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape49>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape49>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape49__Value, &Thunk_Classes4_h_shapes__Shape49__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape49__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape49__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape49__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape49__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape49>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape50, decltype(shapes::Shape50::Value), &shapes::Shape50::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape50>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape50__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape50>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape50__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape50>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape50>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape50__Value, &Thunk_Classes4_h_shapes__Shape50__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape50__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape50__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape50__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape50__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape50>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape51, decltype(shapes::Shape51::Value), &shapes::Shape51::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape51>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape51__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape51>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape51__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape51>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape51>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape51__Value, &Thunk_Classes4_h_shapes__Shape51__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape51__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape51__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape51__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape51__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape51>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape52, decltype(shapes::Shape52::Value), &shapes::Shape52::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape52>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape52__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape52>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape52__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape52>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape52>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape52__Value, &Thunk_Classes4_h_shapes__Shape52__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape52__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape52__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape52__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape52__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape52>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape53, decltype(shapes::Shape53::Value), &shapes::Shape53::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape53>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape53__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape53>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape53__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape53>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape53>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape53__Value, &Thunk_Classes4_h_shapes__Shape53__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape53__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape53__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape53__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape53__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape53>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape54, decltype(shapes::Shape54::Value), &shapes::Shape54::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape54>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape54__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape54>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape54__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape54>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape54>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape54__Value, &Thunk_Classes4_h_shapes__Shape54__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape54__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape54__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape54__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape54__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape54>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape55, decltype(shapes::Shape55::Value), &shapes::Shape55::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape55>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape55__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape55>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape55__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape55>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape55>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape55__Value, &Thunk_Classes4_h_shapes__Shape55__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape55__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape55__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape55__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape55__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape55>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape56, decltype(shapes::Shape56::Value), &shapes::Shape56::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape56>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape56__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape56>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape56__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape56>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape56>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape56__Value, &Thunk_Classes4_h_shapes__Shape56__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape56__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape56__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape56__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape56__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape56>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape57, decltype(shapes::Shape57::Value), &shapes::Shape57::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape57>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape57__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape57>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape57__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape57>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape57>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape57__Value, &Thunk_Classes4_h_shapes__Shape57__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape57__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape57__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape57__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape57__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape57>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape58, decltype(shapes::Shape58::Value), &shapes::Shape58::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape58>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape58__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape58>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape58__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape58>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape58>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape58__Value, &Thunk_Classes4_h_shapes__Shape58__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape58__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape58__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape58__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape58__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape58>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape59, decltype(shapes::Shape59::Value), &shapes::Shape59::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape59>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape59__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape59>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape59__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape59>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape59>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape59__Value, &Thunk_Classes4_h_shapes__Shape59__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape59__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape59__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape59__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape59__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape59>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape60, decltype(shapes::Shape60::Value), &shapes::Shape60::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape60>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape60__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape60>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape60__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape60>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape60>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape60__Value, &Thunk_Classes4_h_shapes__Shape60__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape60__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape60__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape60__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape60__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape60>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape61, decltype(shapes::Shape61::Value), &shapes::Shape61::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape61>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape61__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape61>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape61__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape61>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape61>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape61__Value, &Thunk_Classes4_h_shapes__Shape61__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape61__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape61__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape61__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape61__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape61>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape62, decltype(shapes::Shape62::Value), &shapes::Shape62::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape62>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape62__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape62>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape62__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape62>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape62>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape62__Value, &Thunk_Classes4_h_shapes__Shape62__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape62__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape62__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape62__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape62__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape62>(L, &Table, &ConstTable);
+	}
+	{
+		static const lab::Field Fields[] = {
+			lab::MakeField<shapes::Shape63, decltype(shapes::Shape63::Value), &shapes::Shape63::Value>("Value", LAB_FIELD_OFFSET(Value), true),
+		};
+		lab::BindFields<shapes::Shape63>(L, Fields);
+	}
+	{
+		static const luaL_Reg Methods[] = {
+			{ "Set", &Thunk_Classes4_h_shapes__Shape63__Set },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape63>(L, lab::ClassTable::Methods, Methods);
+		static const luaL_Reg ConstMethods[] = {
+			{ "Get", &Thunk_Classes4_h_shapes__Shape63__Get },
+			{ nullptr, nullptr }
+		};
+		lab::SetFunctions<shapes::Shape63>(L, lab::ClassTable::Methods, ConstMethods);
+		lab::SetFunctions<shapes::Shape63>(L, lab::ClassTable::ConstMethods, ConstMethods);
+		static const lab::IndexEntry TableEntries[] = {
+			{ nullptr, 0, lab::IndexKind::Method, nullptr, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape63__Value, &Thunk_Classes4_h_shapes__Shape63__Value_Set },
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape63__Get, nullptr },
+			{ "Set", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape63__Set, nullptr },
+		};
+		static const lab::IndexTable Table = { 3u, 3, false, TableEntries };
+		static const lab::IndexEntry ConstTableEntries[] = {
+			{ "Get", 3, lab::IndexKind::Method, &Thunk_Classes4_h_shapes__Shape63__Get, nullptr },
+			{ "Value", 5, lab::IndexKind::Property, &Thunk_Classes4_h_shapes__Shape63__Value, nullptr },
+		};
+		static const lab::IndexTable ConstTable = { 3u, 1, false, ConstTableEntries };
+		lab::BindIndex<shapes::Shape63>(L, &Table, &ConstTable);
+	}
+}
+
+void UnregisterStaticLuaProperties_Classes4_h() 
+{
+}
@@ -0,0 +1,245 @@
+#include <lua.hpp>
+#include <luaportal/luaportal.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using std::string;
+using std::vector;
+
+using std::cout;
+using std::cerr;
+using std::endl;
+
+void RegisterAPIs(luaportal::LuaState& LOL);
+
+// The per header registrations lab -s 1 writes, RegisterAPIs calls them in this order
+void RegisterAPIs_Calls_h(luaportal::LuaState& LOL);
+void RegisterAPIs_Classes0_h(luaportal::LuaState& LOL);
+void RegisterAPIs_Classes1_h(luaportal::LuaState& LOL);
+void RegisterAPIs_Classes2_h(luaportal::LuaState& LOL);
+void RegisterAPIs_Classes3_h(luaportal::LuaState& LOL);
+void RegisterAPIs_Classes4_h(luaportal::LuaState& LOL);
+
+// The lab options the bindings of this executable were generated with, set per target by CMakeLists.txt
+#ifndef LAB_BENCH_MODE
+#define LAB_BENCH_MODE "unknown"
+#endif
+
+// One header of the registration sweep and the classes it binds
+struct Registration
+{
+    void (*Register)(luaportal::LuaState& LOL);
+    unsigned Classes;
+};
+
+// The sweep registers the first 1 to all of these, from 3 to 67 classes
+const Registration Registrations[] = {
+    { &RegisterAPIs_Calls_h, 3 },
+    { &RegisterAPIs_Classes0_h, 4 },
+    { &RegisterAPIs_Classes1_h, 4 },
+    { &RegisterAPIs_Classes2_h, 8 },
+    { &RegisterAPIs_Classes3_h, 16 },
+    { &RegisterAPIs_Classes4_h, 32 },
+};
+
+// One crossing, Body runs Operations times inside a lua loop. o is a bench.Counter, d a bench.Leaf, s a 32 byte string
+// and f whatever Local evaluates to, all locals so only the call itself is measured.
+struct Case
+{
+    string Name;
+    string Local;
+    string Body;
+};
+
+vector<Case> GetCases()
+{
+    vector<Case> Cases = {
+        // The loop alone, subtract it from the others for the binding's own cost
+        { "loop", "nil", "" },
+        { "free", "bench.Add", "f(i, 1)" },
+        { "static", "bench.Counter.Twice", "f(i)" },
+    };
+    string Arguments;
+    for (int Count = 0; Count <= 8; ++Count)
+    {
+        Cases.push_back({ "member" + std::to_string(Count), "nil", "o:Arg" + std::to_string(Count) + "(" + Arguments + ")" });
+        Arguments += Arguments.empty() ? "i" : ", i";
+    }
+    Cases.insert(Cases.end(), {
+        { "property_get", "nil", "f = o.Value" },
+        { "property_set", "nil", "o.Value = i" },
+        { "data_get", "nil", "f = o.Data" },
+        { "data_set", "nil", "o.Data = i" },
+        { "derived", "nil", "d:Arg1(i)" },
+        // A new object every call, and the same object again, which --pointers cached pushes from its cache
+        { "push_object", "nil", "o:Copy()" },
+        { "push_same_object", "nil", "o:Self()" },
+        { "cfunction", "bench.Counter.Raw", "f()" },
+        { "string", "bench.Length", "f(s)" },
+        { "string_view", "bench.ViewLength", "f(s)" },
+    });
+    return Cases;
+}
+
+// Nanoseconds per operation of each sample, sorted
+struct Samples
+{
+    vector<double> Values;
+
+    double Percentile(double P) const
+    {
+        auto Rank = static_cast<size_t>(std::ceil(P / 100.0 * Values.size()));
+        return Values[std::max<size_t>(Rank, 1) - 1];
+    }
+
+    double Mean() const
+    {
+        double Sum = 0;
+        for (auto Value : Values)
+        {
+            Sum += Value;
+        }
+        return Sum / Values.size();
+    }
+};
+
+// One json object per line, so runs of every mode can be appended to one file and compared
+void Report(const string& Name, unsigned long Operations, Samples& Result)
+{
+    std::sort(Result.Values.begin(), Result.Values.end());
+    cout << "{\"mode\": \"" << LAB_BENCH_MODE << "\", \"case\": \"" << Name << "\", \"operations\": " << Operations
+        << ", \"samples\": " << Result.Values.size() << ", \"unit\": \"ns/op\", \"min\": " << Result.Values.front()
+        << ", \"p50\": " << Result.Percentile(50) << ", \"p90\": " << Result.Percentile(90)
+        << ", \"p99\": " << Result.Percentile(99) << ", \"max\": " << Result.Values.back()
+        << ", \"mean\": " << Result.Mean() << "}" << endl;
+}
+
+double ElapsedNanoseconds(std::chrono::steady_clock::time_point Start)
+{
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - Start).count());
+}
+
+// Compiles the loop of a case and leaves it on top of the stack
+void LoadCase(lua_State* L, const Case& Item)
+{
+    auto Source = "local n = ... local o, d, f, s = counter, leaf, " + Item.Local + ", string.rep('x', 32) for i = 1, n do " + Item.Body + " end";
+    if (luaL_loadstring(L, Source.c_str()) != LUA_OK)
+    {
+        throw Item.Name + ": " + lua_tostring(L, -1);
+    }
+}
+
+// Cases of functions a mode does not bind, whose Local is nil, are left out of its results
+bool IsBound(lua_State* L, const Case& Item)
+{
+    if (Item.Local == "nil")
+    {
+        return true;
+    }
+    auto Source = "return " + Item.Local;
+    if (luaL_dostring(L, Source.c_str()) != LUA_OK)
+    {
+        throw Item.Name + ": " + lua_tostring(L, -1);
+    }
+    bool bBound = !lua_isnil(L, -1);
+    lua_pop(L, 1);
+    return bBound;
+}
+
+Samples RunCase(lua_State* L, const Case& Item, unsigned SampleCount, unsigned long Operations)
+{
+    LoadCase(L, Item);
+    Samples Result;
+    // The first run warms caches and lets lua grow what it needs, it is not reported
+    for (unsigned i = 0; i <= SampleCount; ++i)
+    {
+        lua_pushvalue(L, -1);
+        lua_pushinteger(L, static_cast<lua_Integer>(Operations));
+        auto Start = std::chrono::steady_clock::now();
+        if (lua_pcall(L, 1, 0, 0) != LUA_OK)
+        {
+            throw Item.Name + ": " + lua_tostring(L, -1);
+        }
+        auto Elapsed = ElapsedNanoseconds(Start);
+        if (i > 0)
+        {
+            Result.Values.push_back(Elapsed / Operations);
+        }
+    }
+    lua_pop(L, 1);
+    return Result;
+}
+
+// Registers the first Count headers of the sweep into a new state per sample, the state's own creation is not timed
+Samples RunRegistration(size_t Count, unsigned SampleCount)
+{
+    Samples Result;
+    for (unsigned i = 0; i <= SampleCount; ++i)
+    {
+        luaportal::LuaState State;
+        auto Start = std::chrono::steady_clock::now();
+        for (size_t Header = 0; Header < Count; ++Header)
+        {
+            Registrations[Header].Register(State);
+        }
+        auto Elapsed = ElapsedNanoseconds(Start);
+        if (i > 0)
+        {
+            Result.Values.push_back(Elapsed);
+        }
+    }
+    return Result;
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned SampleCount = argc > 1 ? static_cast<unsigned>(std::strtoul(argv[1], nullptr, 10)) : 31;
+    unsigned long Operations = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 200000;
+    if (SampleCount == 0 || Operations == 0)
+    {
+        cerr << "usage: " << argv[0] << " [samples] [operations per sample]" << endl;
+        return -1;
+    }
+
+    try
+    {
+        luaportal::LuaState State;
+        RegisterAPIs(State);
+        auto L = State.GetState();
+        if (luaL_dostring(L, "counter = bench.Counter() leaf = bench.Leaf()") != LUA_OK)
+        {
+            throw string(lua_tostring(L, -1));
+        }
+
+        for (auto& Item : GetCases())
+        {
+            if (!IsBound(L, Item))
+            {
+                continue;
+            }
+            auto Result = RunCase(L, Item, SampleCount, Operations);
+            Report(Item.Name, Operations, Result);
+        }
+
+        unsigned Classes = 0;
+        for (size_t Count = 1; Count <= sizeof(Registrations) / sizeof(Registrations[0]); ++Count)
+        {
+            Classes += Registrations[Count - 1].Classes;
+            auto Result = RunRegistration(Count, SampleCount);
+            Report("register_" + std::to_string(Classes), 1, Result);
+        }
+    }
+    catch (const string& Error)
+    {
+        cerr << Error << endl;
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <luaexport>
+
+#include <string_view>
+
+// Only bound by the modes that generate thunks, luaportal does not read std::string_view. The view points into the
+// lua string, so no mode copies it.
+LUA_NAMESPACE(name = bench)
+namespace bench
+{
+    LUA_FUNCTION()
+    inline int ViewLength(std::string_view Text)
+    {
+        return static_cast<int>(Text.size());
+    }
+}